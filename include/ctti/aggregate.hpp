@@ -0,0 +1,54 @@
+#pragma once
+
+#include <ctti/detail/aggregate_impl.hpp>
+#include <ctti/reflection.hpp>
+
+#include <cstddef>
+
+namespace ctti {
+
+/**
+ * @brief Concept that checks if a type can be reflected automatically as an aggregate.
+ * @details T must be a non-polymorphic aggregate class with between one and 64 fields. Fields that are C arrays,
+ * references or bit-fields, and aggregates with base classes, are not supported.
+ * @tparam T The type to check.
+ */
+template <typename T>
+concept aggregate_reflectable = detail::AggregateReflectable<T>;
+
+/**
+ * @brief The number of fields of an aggregate, detected from aggregate initialization.
+ * @tparam T The aggregate type.
+ */
+template <aggregate_reflectable T>
+constexpr std::size_t aggregate_field_count = detail::kAggregateFieldCount<T>;
+
+/**
+ * @brief A meta specialization base that reflects every field of an aggregate without listing them by hand.
+ * @details Fields are bound with structured bindings and named after their declarations, in declaration order.
+ * Inherit from it to opt a type into reflection, or use a constrained partial specialization to opt in a whole
+ * family of types at once.
+ * @tparam T The aggregate type to reflect.
+ *
+ * @example
+ * @code
+ * struct Order {
+ *   std::uint64_t id;
+ *   double price;
+ *   std::string symbol;
+ * };
+ *
+ * template <>
+ * struct ctti::meta<Order> : ctti::aggregate_meta<Order> {};
+ *
+ * auto names = ctti::get_symbol_names<Order>();  // {"id", "price", "symbol"}
+ * @endcode
+ */
+template <aggregate_reflectable T>
+struct aggregate_meta {
+  using type = T;
+
+  static constexpr auto reflection = ctti::reflection<detail::AggregateReflectionType<T>>{};
+};
+
+}  // namespace ctti
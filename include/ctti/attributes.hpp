@@ -116,6 +116,27 @@ public:
     return detail::Contains<NamedAttr, attributes_type>::value;
   }
 
+  /**
+   * @brief Checks if the attribute list contains a key/value attribute with the specified key.
+   * @tparam Key The key to check for.
+   * @return true if the attribute list contains a kv attribute with the key, false otherwise.
+   */
+  template <detail::CompileTimeString Key>
+  [[nodiscard]] static constexpr bool has_key() noexcept {
+    return internal_list::template HasKey<Key>();
+  }
+
+  /**
+   * @brief Gets the value of the key/value attribute with the specified key.
+   * @tparam Key The key of the value, which the list must contain.
+   * @return The value of the first kv attribute with the key.
+   */
+  template <detail::CompileTimeString Key>
+    requires(internal_list::template HasKey<Key>())
+  [[nodiscard]] static constexpr auto get_key_value() noexcept {
+    return internal_list::template GetKeyValue<Key>();
+  }
+
   /**
    * @brief Applies a given function to each attribute in the attribute list.
    * @tparam F The type of the function to apply. It must be invocable with each attribute type.
@@ -135,16 +156,86 @@ struct write_only_tag {};
 struct deprecated_tag {};
 struct internal_tag {};
 struct validated_tag {};
+struct hot_tag {};
+struct cold_tag {};
 
 using read_only = tag_attribute<read_only_tag>;
 using write_only = tag_attribute<write_only_tag>;
 using deprecated = tag_attribute<deprecated_tag>;
 using internal = tag_attribute<internal_tag>;
 using validated = tag_attribute<validated_tag>;
+using hot = tag_attribute<hot_tag>;
+using cold = tag_attribute<cold_tag>;
 
 template <int Version>
 using since = attribute_value<Version>;
 
+/**
+ * @brief Sets the position of a symbol in the field order used by reflected comparisons.
+ * @details Symbols with a compare_order are compared first, by ascending position. The remaining symbols follow in
+ * reflection order.
+ * @tparam Position The position of the symbol.
+ */
+template <std::size_t Position>
+struct compare_order {
+  static constexpr std::size_t position = Position;
+  static constexpr std::string_view name = "compare_order";
+};
+
+/**
+ * @brief Attaches a compile-time value to a symbol under a key, read back with attribute_get.
+ * @details Useful for metadata that drives generated code, such as wire field numbers or column widths.
+ * @tparam Key The compile-time string identifying the value.
+ * @tparam Value The value, of any structural type.
+ */
+template <detail::CompileTimeString Key, auto Value>
+struct kv {
+  static constexpr std::string_view key = Key.View();
+  static constexpr std::string_view name = Key.View();
+  static constexpr auto value = Value;
+};
+
+/**
+ * @brief Constrains an arithmetic data member to the closed interval [Min, Max], checked by ctti::validate.
+ * @tparam Min The smallest valid value.
+ * @tparam Max The largest valid value.
+ */
+template <auto Min, auto Max>
+  requires(Min <= Max)
+struct range {
+  static constexpr auto min = Min;
+  static constexpr auto max = Max;
+  static constexpr std::string_view name = "range";
+};
+
+/**
+ * @brief Constrains a string or container data member to hold at least one element, checked by ctti::validate.
+ */
+struct non_empty {
+  static constexpr std::string_view name = "non_empty";
+};
+
+/**
+ * @brief Constrains a string or container data member to hold at most Length elements, checked by ctti::validate.
+ * @tparam Length The largest valid size.
+ */
+template <std::size_t Length>
+struct max_length {
+  static constexpr std::size_t length = Length;
+  static constexpr std::string_view name = "max_length";
+};
+
+/**
+ * @brief Sets the number of bits a data member takes in the encoding of ctti::packed.
+ * @tparam Width The number of bits, from 1 to 64.
+ */
+template <std::size_t Width>
+  requires(Width >= 1 && Width <= 64)
+struct bits {
+  static constexpr std::size_t width = Width;
+  static constexpr std::string_view name = "bits";
+};
+
 using description = named_attribute<detail::DescriptionHolder>;
 
 template <detail::CompileTimeString Desc>
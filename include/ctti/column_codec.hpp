@@ -0,0 +1,88 @@
+#pragma once
+
+#include <ctti/detail/column_codec_impl.hpp>
+#include <ctti/reflection.hpp>
+#include <ctti/serialize.hpp>
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace ctti {
+
+/**
+ * @brief Concept that checks if a reflectable type can be encoded column by column.
+ * @details Every leaf of T, with nested reflectable data members flattened, must be an integer, an enum, a float or
+ * a double.
+ * @tparam T The type to check.
+ */
+template <typename T>
+concept column_encodable = reflectable<T> && detail::ColumnCodecsOf<T>::kEncodable;
+
+/**
+ * @brief Encodes a sequence of records as one compressed column per leaf.
+ * @details Integer columns store the zigzag varint of the difference to the previous record. Columns of registered
+ * enums store the index of each value in its enum_values list, packed into as few bits as the list needs, and fall
+ * back to the integer encoding if a value is not registered. Floating-point columns XOR the bits of each value with
+ * the previous one and store only the meaningful bits between the leading and trailing zeros, reusing the previous
+ * window when they fit, as in Gorilla. When every value is a short decimal, such as a price, and it takes fewer bytes,
+ * the column instead stores the delta varints of the values scaled to integers by a power of ten. Slowly changing
+ * series, such as time series of small structs, shrink to a few bytes per record.
+ * @tparam T The column-encodable type of the records.
+ * @param objects The records to encode.
+ * @param writer The writer to append the encoded records to.
+ *
+ * @example
+ * @code
+ * ctti::byte_writer writer;
+ * ctti::encode_columns(std::span<const Tick>(ticks), writer);
+ * @endcode
+ */
+template <column_encodable T>
+void encode_columns(std::span<const T> objects, byte_writer& writer) {
+  using codecs = detail::ColumnCodecsOf<T>;
+  const auto count = static_cast<std::uint64_t>(objects.size());
+  writer.write_bytes(&count, sizeof(count));
+  std::vector<std::byte> column;
+  for (const auto& encode : codecs::kEncoders) {
+    encode(objects, column);
+    const auto size = static_cast<std::uint64_t>(column.size());
+    writer.write_bytes(&size, sizeof(size));
+    writer.write_bytes(column.data(), column.size());
+  }
+}
+
+/**
+ * @brief Decodes records written by encode_columns.
+ * @details Each column is decoded in separate passes over a scratch buffer: the varints or XOR bit stream first, then
+ * the zigzag and prefix-sum passes, then the stores into the records. Each pass is a tight loop over contiguous memory.
+ * @tparam T The column-encodable type of the records.
+ * @param reader The reader to consume.
+ * @param objects The vector to replace with the decoded records.
+ * @return True on success, false if the input is truncated or malformed.
+ */
+template <column_encodable T>
+  requires std::default_initializable<T>
+[[nodiscard]] bool decode_columns(byte_reader& reader, std::vector<T>& objects) {
+  using codecs = detail::ColumnCodecsOf<T>;
+  std::uint64_t count = 0;
+  // Every column takes at least one byte per eight records
+  if (!reader.read_bytes(&count, sizeof(count)) || (codecs::kCount != 0 && count / 8 > reader.remaining())) {
+    return false;
+  }
+  objects.assign(static_cast<std::size_t>(count), T{});
+  std::vector<std::uint64_t> scratch;
+  for (const auto& decode : codecs::kDecoders) {
+    std::uint64_t size = 0;
+    std::span<const std::byte> column;
+    if (!reader.read_bytes(&size, sizeof(size)) || size > reader.remaining() ||
+        !reader.read_span(static_cast<std::size_t>(size), column) || !decode(column, objects, scratch)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace ctti
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <ctti/detail/compare_impl.hpp>
+#include <ctti/reflection.hpp>
+
+namespace ctti {
+
+/**
+ * @brief The comparison category returned by reflected_compare for T.
+ * @details The common comparison category of all data members, where nested reflectable members contribute their own
+ * reflected category and members that only provide operator< contribute std::weak_ordering.
+ * @tparam T The reflectable type.
+ */
+template <reflectable T>
+using reflected_compare_category = detail::ReflectedCompareCategory<T>;
+
+/**
+ * @brief An equality function object that compares the reflected data members of two objects.
+ * @details When the data members cover every byte of T and T has a unique object representation, the objects are
+ * compared with a single memcmp. Otherwise the leading run of bytewise comparable members is compared with one
+ * memcmp when the members are laid out back to back, and the remaining members are compared one by one.
+ * @tparam T The reflectable type to compare.
+ */
+template <reflectable T>
+struct reflected_equal {
+  /**
+   * @brief Checks if two objects have equal data members.
+   * @param lhs The first object.
+   * @param rhs The second object.
+   * @return True if every reflected data member compares equal, false otherwise.
+   */
+  [[nodiscard]] bool operator()(const T& lhs, const T& rhs) const { return detail::ReflectedEqual(lhs, rhs); }
+};
+
+/**
+ * @brief A three-way comparison function object that orders objects lexicographically by their data members.
+ * @details Members carrying the compare_order attribute are compared first, by ascending position, followed by the
+ * remaining members in reflection order. A leading run of byte-sized unsigned members laid out back to back is
+ * ordered with a single memcmp.
+ * @tparam T The reflectable type to compare.
+ *
+ * @example
+ * @code
+ * if (ctti::reflected_compare<Version>{}(a, b) < 0) {
+ *   // a is older than b
+ * }
+ * @endcode
+ */
+template <reflectable T>
+struct reflected_compare {
+  /**
+   * @brief Compares two objects lexicographically.
+   * @param lhs The first object.
+   * @param rhs The second object.
+   * @return The result of the first data member comparison that is not equal, or equal if there is none.
+   */
+  [[nodiscard]] reflected_compare_category<T> operator()(const T& lhs, const T& rhs) const {
+    return detail::ReflectedCompare(lhs, rhs);
+  }
+};
+
+/**
+ * @brief A less-than function object built on reflected_compare, suitable for sorting and ordered containers.
+ * @tparam T The reflectable type to compare.
+ *
+ * @example
+ * @code
+ * std::sort(versions.begin(), versions.end(), ctti::reflected_less<Version>{});
+ * @endcode
+ */
+template <reflectable T>
+struct reflected_less {
+  /**
+   * @brief Checks if one object orders before another.
+   * @param lhs The first object.
+   * @param rhs The second object.
+   * @return True if lhs orders before rhs, false otherwise.
+   */
+  [[nodiscard]] bool operator()(const T& lhs, const T& rhs) const { return detail::ReflectedCompare(lhs, rhs) < 0; }
+};
+
+}  // namespace ctti
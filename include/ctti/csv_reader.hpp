@@ -0,0 +1,233 @@
+#pragma once
+
+#include <ctti/detail/csv_impl.hpp>
+#include <ctti/reflection.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <istream>
+#include <string_view>
+#include <vector>
+
+namespace ctti {
+
+/**
+ * @brief Concept that checks if a reflectable type can be read from CSV rows.
+ * @details Every data member must be an arithmetic value, an enum or a std::string. Enums with registered values
+ * are parsed by name, other enums by their underlying value.
+ * @tparam T The type to check.
+ */
+template <typename T>
+concept csv_readable = reflectable<T> && detail::CsvFieldsOf<T>::kParsable;
+
+/**
+ * @brief Reads objects from CSV or TSV input, one row at a time.
+ * @details The first row is a header. Its columns are matched once against the names of the data members through
+ * a perfect hash, and columns that match no data member are skipped. Every row is then parsed straight from a reused
+ * input buffer, with std::from_chars for numbers, so no cell is copied into a temporary string. Quoted cells may hold
+ * delimiters, line breaks and doubled quotes. Empty cells leave the data member unchanged.
+ * @tparam T The reflectable type of the rows.
+ *
+ * @example
+ * @code
+ * std::ifstream input("trades.csv");
+ * ctti::csv_reader<Trade> reader(input);
+ * Trade trade;
+ * while (reader.next(trade)) {
+ *   process(trade);
+ * }
+ * if (reader.failed()) {
+ *   report_bad_line(reader.line());
+ * }
+ * @endcode
+ */
+template <csv_readable T>
+class csv_reader {
+private:
+  using internal_fields = detail::CsvFieldsOf<T>;
+
+public:
+  /// Size of the input buffer unless another size is given. The buffer grows if a row does not fit.
+  static constexpr std::size_t default_buffer_size = 1 << 16;
+
+  /**
+   * @brief Constructs a reader over an input stream.
+   * @param input The stream to read from, which must outlive the reader.
+   * @param delimiter The cell delimiter, such as ',' for CSV or '\t' for TSV.
+   * @param buffer_size The initial size of the input buffer.
+   */
+  explicit csv_reader(std::istream& input, char delimiter = ',', std::size_t buffer_size = default_buffer_size)
+      : input_(&input), delimiter_(delimiter), buffer_(std::max<std::size_t>(buffer_size, 1)) {}
+
+  /**
+   * @brief Reads the next row into an object, reading the header first if needed.
+   * @param object The object to assign the cells of the row to.
+   * @return True if a row was read, false at the end of the input or if a cell could not be parsed, in which case
+   * failed() returns true.
+   */
+  [[nodiscard]] bool next(T& object) {
+    if (failed_ || (!header_read_ && !ReadHeader())) {
+      return false;
+    }
+    char* begin = nullptr;
+    char* end = nullptr;
+    while (NextLine(begin, end)) {
+      if (begin == end) {
+        continue;
+      }
+      bool parsed = true;
+      ForEachCell(begin, end, [&](std::size_t column, std::string_view cell) {
+        if (parsed && column < fields_.size() && fields_[column] < internal_fields::kCount) {
+          parsed = internal_fields::kParsers[fields_[column]](cell, object);
+        }
+      });
+      failed_ = !parsed;
+      return parsed;
+    }
+    return false;
+  }
+
+  /**
+   * @brief Checks if reading stopped at a cell that could not be parsed.
+   * @return True if a cell could not be parsed, false otherwise.
+   */
+  [[nodiscard]] bool failed() const noexcept { return failed_; }
+
+  /**
+   * @brief Gets the line number of the last row read, counting the header as line 1.
+   * @return The line number, or 0 if nothing was read yet.
+   */
+  [[nodiscard]] std::size_t line() const noexcept { return line_; }
+
+  /**
+   * @brief Gets the number of header columns that matched a data member.
+   * @return The number of matched columns, or 0 if the header was not read yet.
+   */
+  [[nodiscard]] std::size_t matched_columns() const noexcept {
+    return static_cast<std::size_t>(std::count_if(fields_.begin(), fields_.end(),
+                                                  [](std::size_t field) { return field < internal_fields::kCount; }));
+  }
+
+private:
+  [[nodiscard]] bool ReadHeader() {
+    header_read_ = true;
+    char* begin = nullptr;
+    char* end = nullptr;
+    if (!NextLine(begin, end)) {
+      return false;
+    }
+    constexpr std::string_view kByteOrderMark = "\xEF\xBB\xBF";
+    if (std::string_view(begin, end).starts_with(kByteOrderMark)) {
+      begin += kByteOrderMark.size();
+    }
+    ForEachCell(begin, end, [&](std::size_t /*column*/, std::string_view name) {
+      fields_.push_back(internal_fields::kIndex.Find(name));
+    });
+    return true;
+  }
+
+  // Finds the next line break outside of quotes, refilling the buffer as needed. The line is left in the buffer
+  // without its line break, and stays valid until the next call.
+  [[nodiscard]] bool NextLine(char*& begin, char*& end) {
+    bool quoted = false;
+    std::size_t scan = begin_;
+    for (;;) {
+      for (; scan < end_; ++scan) {
+        const char ch = buffer_[scan];
+        if (ch == '"') {
+          quoted = !quoted;
+        } else if (ch == '\n' && !quoted) {
+          SetLine(begin, end, scan);
+          begin_ = scan + 1;
+          return true;
+        }
+      }
+      if (eof_) {
+        if (begin_ == end_) {
+          return false;
+        }
+        SetLine(begin, end, end_);
+        begin_ = end_;
+        return true;
+      }
+      scan -= begin_;
+      Refill();
+    }
+  }
+
+  void SetLine(char*& begin, char*& end, std::size_t line_end) noexcept {
+    begin = buffer_.data() + begin_;
+    end = buffer_.data() + line_end;
+    if (end != begin && end[-1] == '\r') {
+      --end;
+    }
+    ++line_;
+  }
+
+  // Moves the unread bytes to the front of the buffer, growing it if they fill it, and reads more input after them
+  void Refill() {
+    const std::size_t unread = end_ - begin_;
+    if (begin_ != 0 && unread != 0) {
+      std::memmove(buffer_.data(), buffer_.data() + begin_, unread);
+    }
+    begin_ = 0;
+    end_ = unread;
+    if (end_ == buffer_.size()) {
+      buffer_.resize(buffer_.size() * 2);
+    }
+    input_->read(buffer_.data() + end_, static_cast<std::streamsize>(buffer_.size() - end_));
+    const auto count = static_cast<std::size_t>(input_->gcount());
+    end_ += count;
+    eof_ = count == 0;
+  }
+
+  // Splits a line into cells. Quoted cells are unescaped in place, since the buffer is overwritten by the next line.
+  template <typename F>
+  void ForEachCell(char* begin, char* end, const F& func) const {
+    std::size_t column = 0;
+    char* position = begin;
+    for (;;) {
+      std::string_view cell;
+      if (position != end && *position == '"') {
+        char* out = position;
+        char* in = position + 1;
+        while (in != end) {
+          if (*in != '"') {
+            *out++ = *in++;
+          } else if (in + 1 != end && in[1] == '"') {
+            *out++ = '"';
+            in += 2;
+          } else {
+            ++in;
+            break;
+          }
+        }
+        cell = std::string_view(position, out);
+        position = std::find(in, end, delimiter_);
+      } else {
+        char* delimiter = std::find(position, end, delimiter_);
+        cell = std::string_view(position, delimiter);
+        position = delimiter;
+      }
+      func(column++, cell);
+      if (position == end) {
+        return;
+      }
+      ++position;
+    }
+  }
+
+  std::istream* input_;
+  char delimiter_;
+  std::vector<char> buffer_;
+  std::size_t begin_ = 0;
+  std::size_t end_ = 0;
+  std::vector<std::size_t> fields_;
+  std::size_t line_ = 0;
+  bool header_read_ = false;
+  bool eof_ = false;
+  bool failed_ = false;
+};
+
+}  // namespace ctti
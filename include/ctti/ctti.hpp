@@ -1,18 +1,38 @@
 #pragma once
 
+#include <ctti/aggregate.hpp>
 #include <ctti/attributes.hpp>
+#include <ctti/column_codec.hpp>
+#include <ctti/compare.hpp>
 #include <ctti/concepts.hpp>
 #include <ctti/constructor.hpp>
+#include <ctti/csv_reader.hpp>
+#include <ctti/diff.hpp>
 #include <ctti/enum_utils.hpp>
+#include <ctti/execution.hpp>
+#include <ctti/flatten.hpp>
 #include <ctti/hash.hpp>
 #include <ctti/inheritance.hpp>
+#include <ctti/layout_info.hpp>
 #include <ctti/map.hpp>
 #include <ctti/model.hpp>
 #include <ctti/name.hpp>
+#include <ctti/packed.hpp>
+#include <ctti/record_file.hpp>
+#include <ctti/reflected_hash.hpp>
 #include <ctti/reflection.hpp>
+#include <ctti/rpc.hpp>
+#include <ctti/schema_hash.hpp>
+#include <ctti/serialize.hpp>
+#include <ctti/soa_vector.hpp>
+#include <ctti/split_storage.hpp>
 #include <ctti/static_value.hpp>
 #include <ctti/symbol.hpp>
+#include <ctti/symbol_list.hpp>
+#include <ctti/tag_index.hpp>
 #include <ctti/template_info.hpp>
 #include <ctti/tie.hpp>
 #include <ctti/type_id.hpp>
 #include <ctti/type_tag.hpp>
+#include <ctti/validate.hpp>
+#include <ctti/view.hpp>
@@ -0,0 +1,1280 @@
+#pragma once
+
+#include <ctti/detail/compile_time_string.hpp>
+#include <ctti/detail/member_traits.hpp>
+#include <ctti/detail/pretty_function.hpp>
+#include <ctti/detail/reflection_impl.hpp>
+#include <ctti/detail/symbol_impl.hpp>
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace ctti::detail {
+
+constexpr std::size_t kMaxAggregateFields = 64;
+
+// Converts to any type in unevaluated aggregate initialization, used to count the fields of an aggregate
+struct AnyField {
+  template <typename U>
+  constexpr operator U() const noexcept;  // NOLINT(google-explicit-constructor)
+};
+
+// Only converts to proper base classes of T, so it can initialize the first element of T only if that is a base
+template <typename T>
+struct AnyBaseOf {
+  template <typename U>
+    requires(std::is_base_of_v<U, T> && !std::same_as<U, T>)
+  constexpr operator U() const noexcept;  // NOLINT(google-explicit-constructor)
+};
+
+template <typename T, std::size_t N>
+[[nodiscard]] consteval bool IsInitializableWithFields() noexcept {
+  return []<std::size_t... Is>(std::index_sequence<Is...>) {
+    return requires { T{(static_cast<void>(Is), AnyField{})...}; };
+  }(std::make_index_sequence<N>{});
+}
+
+// Largest number of initializers T can be aggregate-initialized with. Every field is initialized from a single
+// AnyField, so this is the number of fields as long as none of them is a C array.
+template <typename T, std::size_t N = 0>
+[[nodiscard]] consteval std::size_t CountAggregateFields() noexcept {
+  if constexpr (N <= kMaxAggregateFields && IsInitializableWithFields<T, N + 1>()) {
+    return CountAggregateFields<T, N + 1>();
+  } else {
+    return N;
+  }
+}
+
+template <typename T>
+constexpr std::size_t kAggregateFieldCount = CountAggregateFields<T>();
+
+// Base classes are initialized before the fields, so they would be counted and bound as fields
+template <typename T>
+constexpr bool kHasAggregateBase = requires { T{AnyBaseOf<T>{}}; };
+
+// Brace elision spreads the initializers of a C array over several fields. An empty brace initializes a whole array at
+// once, so if one does at some position, the initializers that follow no longer fit.
+template <typename T, std::size_t Before, std::size_t After>
+[[nodiscard]] consteval bool IsInitializableWithBraceAt() noexcept {
+  return []<std::size_t... Bs, std::size_t... As>(std::index_sequence<Bs...>, std::index_sequence<As...>) {
+    return requires { T{(static_cast<void>(Bs), AnyField{})..., {}, (static_cast<void>(As), AnyField{})...}; };
+  }(std::make_index_sequence<Before>{}, std::make_index_sequence<After>{});
+}
+
+template <typename T, std::size_t N = kAggregateFieldCount<T>>
+[[nodiscard]] consteval bool HasArrayField() noexcept {
+  return []<std::size_t... Is>(std::index_sequence<Is...>) {
+    return ((IsInitializableWithBraceAt<T, Is, 0>() && !IsInitializableWithBraceAt<T, Is, N - Is - 1>()) || ...);
+  }(std::make_index_sequence<N>{});
+}
+
+// Converts to lvalue references, which AnyField cannot bind to, so the count stops before a non-const reference field
+struct AnyLvalueField {
+  template <typename U>
+  constexpr operator U&() const noexcept;  // NOLINT(google-explicit-constructor)
+};
+
+template <typename T>
+constexpr bool kHasUncountedField = []<std::size_t... Is>(std::index_sequence<Is...>) {
+  return requires { T{(static_cast<void>(Is), AnyField{})..., AnyLvalueField{}}; };
+}(std::make_index_sequence<kAggregateFieldCount<T>>{});
+
+// Binds the fields of an aggregate with structured bindings and returns references to them
+template <std::size_t N, typename T>
+[[nodiscard]] constexpr auto TieFields(T& object) noexcept {
+  if constexpr (N == 1) {
+    auto& [f0] = object;
+    return std::tie(f0);
+  } else if constexpr (N == 2) {
+    auto& [f0, f1] = object;
+    return std::tie(f0, f1);
+  } else if constexpr (N == 3) {
+    auto& [f0, f1, f2] = object;
+    return std::tie(f0, f1, f2);
+  } else if constexpr (N == 4) {
+    auto& [f0, f1, f2, f3] = object;
+    return std::tie(f0, f1, f2, f3);
+  } else if constexpr (N == 5) {
+    auto& [f0, f1, f2, f3, f4] = object;
+    return std::tie(f0, f1, f2, f3, f4);
+  } else if constexpr (N == 6) {
+    auto& [f0, f1, f2, f3, f4, f5] = object;
+    return std::tie(f0, f1, f2, f3, f4, f5);
+  } else if constexpr (N == 7) {
+    auto& [f0, f1, f2, f3, f4, f5, f6] = object;
+    return std::tie(f0, f1, f2, f3, f4, f5, f6);
+  } else if constexpr (N == 8) {
+    auto& [f0, f1, f2, f3, f4, f5, f6, f7] = object;
+    return std::tie(f0, f1, f2, f3, f4, f5, f6, f7);
+  } else if constexpr (N == 9) {
+    auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8] = object;
+    return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8);
+  } else if constexpr (N == 10) {
+    auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9] = object;
+    return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9);
+  } else if constexpr (N == 11) {
+    auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10] = object;
+    return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10);
+  } else if constexpr (N == 12) {
+    auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11] = object;
+    return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11);
+  } else if constexpr (N == 13) {
+    auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12] = object;
+    return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12);
+  } else if constexpr (N == 14) {
+    auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13] = object;
+    return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13);
+  } else if constexpr (N == 15) {
+    auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14] = object;
+    return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14);
+  } else if constexpr (N == 16) {
+    auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15] = object;
+    return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15);
+  } else if constexpr (N == 17) {
+    auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16] = object;
+    return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16);
+  } else if constexpr (N == 18) {
+    auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17] = object;
+    return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17);
+  } else if constexpr (N == 19) {
+    auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18] = object;
+    return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18);
+  } else if constexpr (N == 20) {
+    auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19] = object;
+    return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19);
+  } else if constexpr (N == 21) {
+    auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20] = object;
+    return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20);
+  } else if constexpr (N == 22) {
+    auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21] = object;
+    return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21);
+  } else if constexpr (N == 23) {
+    auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21,
+           f22] = object;
+    return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21,
+                    f22);
+  } else if constexpr (N == 24) {
+    auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22,
+           f23] = object;
+    return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21,
+                    f22, f23);
+  } else if constexpr (N == 25) {
+    auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23,
+           f24] = object;
+    return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21,
+                    f22, f23, f24);
+  } else if constexpr (N == 26) {
+    auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23,
+           f24, f25] = object;
+    return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21,
+                    f22, f23, f24, f25);
+  } else if constexpr (N == 27) {
+    auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23,
+           f24, f25, f26] = object;
+    return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21,
+                    f22, f23, f24, f25, f26);
+  } else if constexpr (N == 28) {
+    auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23,
+           f24, f25, f26, f27] = object;
+    return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21,
+                    f22, f23, f24, f25, f26, f27);
+  } else if constexpr (N == 29) {
+    auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23,
+           f24, f25, f26, f27, f28] = object;
+    return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21,
+                    f22, f23, f24, f25, f26, f27, f28);
+  } else if constexpr (N == 30) {
+    auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23,
+           f24, f25, f26, f27, f28, f29] = object;
+    return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21,
+                    f22, f23, f24, f25, f26, f27, f28, f29);
+  } else if constexpr (N == 31) {
+    auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23,
+           f24, f25, f26, f27, f28, f29, f30] = object;
+    return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21,
+                    f22, f23, f24, f25, f26, f27, f28, f29, f30);
+  } else if constexpr (N == 32) {
+    auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23,
+           f24, f25, f26, f27, f28, f29, f30, f31] = object;
+    return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21,
+                    f22, f23, f24, f25, f26, f27, f28, f29, f30, f31);
+  } else if constexpr (N == 33) {
+    auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23,
+           f24, f25, f26, f27, f28, f29, f30, f31, f32] = object;
+    return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21,
+                    f22, f23, f24, f25, f26, f27, f28, f29, f30, f31, f32);
+  } else if constexpr (N == 34) {
+    auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23,
+           f24, f25, f26, f27, f28, f29, f30, f31, f32, f33] = object;
+    return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21,
+                    f22, f23, f24, f25, f26, f27, f28, f29, f30, f31, f32, f33);
+  } else if constexpr (N == 35) {
+    auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23,
+           f24, f25, f26, f27, f28, f29, f30, f31, f32, f33, f34] = object;
+    return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21,
+                    f22, f23, f24, f25, f26, f27, f28, f29, f30, f31, f32, f33, f34);
+  } else if constexpr (N == 36) {
+    auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23,
+           f24, f25, f26, f27, f28, f29, f30, f31, f32, f33, f34, f35] = object;
+    return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21,
+                    f22, f23, f24, f25, f26, f27, f28, f29, f30, f31, f32, f33, f34, f35);
+  } else if constexpr (N == 37) {
+    auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23,
+           f24, f25, f26, f27, f28, f29, f30, f31, f32, f33, f34, f35, f36] = object;
+    return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21,
+                    f22, f23, f24, f25, f26, f27, f28, f29, f30, f31, f32, f33, f34, f35, f36);
+  } else if constexpr (N == 38) {
+    auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23,
+           f24, f25, f26, f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37] = object;
+    return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21,
+                    f22, f23, f24, f25, f26, f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37);
+  } else if constexpr (N == 39) {
+    auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23,
+           f24, f25, f26, f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38] = object;
+    return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21,
+                    f22, f23, f24, f25, f26, f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38);
+  } else if constexpr (N == 40) {
+    auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23,
+           f24, f25, f26, f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39] = object;
+    return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21,
+                    f22, f23, f24, f25, f26, f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39);
+  } else if constexpr (N == 41) {
+    auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23,
+           f24, f25, f26, f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40] = object;
+    return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21,
+                    f22, f23, f24, f25, f26, f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40);
+  } else if constexpr (N == 42) {
+    auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23,
+           f24, f25, f26, f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41] = object;
+    return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21,
+                    f22, f23, f24, f25, f26, f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41);
+  } else if constexpr (N == 43) {
+    auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23,
+           f24, f25, f26, f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42] = object;
+    return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21,
+                    f22, f23, f24, f25, f26, f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41,
+                    f42);
+  } else if constexpr (N == 44) {
+    auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23,
+           f24, f25, f26, f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43] = object;
+    return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21,
+                    f22, f23, f24, f25, f26, f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41,
+                    f42, f43);
+  } else if constexpr (N == 45) {
+    auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23,
+           f24, f25, f26, f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43,
+           f44] = object;
+    return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21,
+                    f22, f23, f24, f25, f26, f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41,
+                    f42, f43, f44);
+  } else if constexpr (N == 46) {
+    auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23,
+           f24, f25, f26, f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44,
+           f45] = object;
+    return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21,
+                    f22, f23, f24, f25, f26, f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41,
+                    f42, f43, f44, f45);
+  } else if constexpr (N == 47) {
+    auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23,
+           f24, f25, f26, f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44, f45,
+           f46] = object;
+    return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21,
+                    f22, f23, f24, f25, f26, f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41,
+                    f42, f43, f44, f45, f46);
+  } else if constexpr (N == 48) {
+    auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23,
+           f24, f25, f26, f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44, f45,
+           f46, f47] = object;
+    return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21,
+                    f22, f23, f24, f25, f26, f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41,
+                    f42, f43, f44, f45, f46, f47);
+  } else if constexpr (N == 49) {
+    auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23,
+           f24, f25, f26, f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44, f45,
+           f46, f47, f48] = object;
+    return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21,
+                    f22, f23, f24, f25, f26, f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41,
+                    f42, f43, f44, f45, f46, f47, f48);
+  } else if constexpr (N == 50) {
+    auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23,
+           f24, f25, f26, f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44, f45,
+           f46, f47, f48, f49] = object;
+    return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21,
+                    f22, f23, f24, f25, f26, f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41,
+                    f42, f43, f44, f45, f46, f47, f48, f49);
+  } else if constexpr (N == 51) {
+    auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23,
+           f24, f25, f26, f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44, f45,
+           f46, f47, f48, f49, f50] = object;
+    return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21,
+                    f22, f23, f24, f25, f26, f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41,
+                    f42, f43, f44, f45, f46, f47, f48, f49, f50);
+  } else if constexpr (N == 52) {
+    auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23,
+           f24, f25, f26, f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44, f45,
+           f46, f47, f48, f49, f50, f51] = object;
+    return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21,
+                    f22, f23, f24, f25, f26, f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41,
+                    f42, f43, f44, f45, f46, f47, f48, f49, f50, f51);
+  } else if constexpr (N == 53) {
+    auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23,
+           f24, f25, f26, f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44, f45,
+           f46, f47, f48, f49, f50, f51, f52] = object;
+    return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21,
+                    f22, f23, f24, f25, f26, f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41,
+                    f42, f43, f44, f45, f46, f47, f48, f49, f50, f51, f52);
+  } else if constexpr (N == 54) {
+    auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23,
+           f24, f25, f26, f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44, f45,
+           f46, f47, f48, f49, f50, f51, f52, f53] = object;
+    return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21,
+                    f22, f23, f24, f25, f26, f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41,
+                    f42, f43, f44, f45, f46, f47, f48, f49, f50, f51, f52, f53);
+  } else if constexpr (N == 55) {
+    auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23,
+           f24, f25, f26, f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44, f45,
+           f46, f47, f48, f49, f50, f51, f52, f53, f54] = object;
+    return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21,
+                    f22, f23, f24, f25, f26, f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41,
+                    f42, f43, f44, f45, f46, f47, f48, f49, f50, f51, f52, f53, f54);
+  } else if constexpr (N == 56) {
+    auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23,
+           f24, f25, f26, f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44, f45,
+           f46, f47, f48, f49, f50, f51, f52, f53, f54, f55] = object;
+    return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21,
+                    f22, f23, f24, f25, f26, f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41,
+                    f42, f43, f44, f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55);
+  } else if constexpr (N == 57) {
+    auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23,
+           f24, f25, f26, f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44, f45,
+           f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56] = object;
+    return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21,
+                    f22, f23, f24, f25, f26, f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41,
+                    f42, f43, f44, f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56);
+  } else if constexpr (N == 58) {
+    auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23,
+           f24, f25, f26, f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44, f45,
+           f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56, f57] = object;
+    return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21,
+                    f22, f23, f24, f25, f26, f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41,
+                    f42, f43, f44, f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56, f57);
+  } else if constexpr (N == 59) {
+    auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23,
+           f24, f25, f26, f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44, f45,
+           f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56, f57, f58] = object;
+    return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21,
+                    f22, f23, f24, f25, f26, f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41,
+                    f42, f43, f44, f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56, f57, f58);
+  } else if constexpr (N == 60) {
+    auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23,
+           f24, f25, f26, f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44, f45,
+           f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56, f57, f58, f59] = object;
+    return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21,
+                    f22, f23, f24, f25, f26, f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41,
+                    f42, f43, f44, f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56, f57, f58, f59);
+  } else if constexpr (N == 61) {
+    auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23,
+           f24, f25, f26, f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44, f45,
+           f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56, f57, f58, f59, f60] = object;
+    return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21,
+                    f22, f23, f24, f25, f26, f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41,
+                    f42, f43, f44, f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56, f57, f58, f59, f60);
+  } else if constexpr (N == 62) {
+    auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23,
+           f24, f25, f26, f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44, f45,
+           f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56, f57, f58, f59, f60, f61] = object;
+    return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21,
+                    f22, f23, f24, f25, f26, f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41,
+                    f42, f43, f44, f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56, f57, f58, f59, f60, f61);
+  } else if constexpr (N == 63) {
+    auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23,
+           f24, f25, f26, f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44, f45,
+           f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56, f57, f58, f59, f60, f61, f62] = object;
+    return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21,
+                    f22, f23, f24, f25, f26, f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41,
+                    f42, f43, f44, f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56, f57, f58, f59, f60, f61,
+                    f62);
+  } else if constexpr (N == 64) {
+    auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23,
+           f24, f25, f26, f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44, f45,
+           f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56, f57, f58, f59, f60, f61, f62, f63] = object;
+    return std::tie(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21,
+                    f22, f23, f24, f25, f26, f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41,
+                    f42, f43, f44, f45, f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56, f57, f58, f59, f60, f61,
+                    f62, f63);
+  } else {
+    static_assert(N <= kMaxAggregateFields, "Aggregate has too many fields to be reflected automatically");
+    return std::tie();
+  }
+}
+
+template <typename T>
+using AggregateFieldsType = decltype(TieFields<kAggregateFieldCount<T>>(std::declval<T&>()));
+
+/**
+ * @brief Accessor for the I-th field of an aggregate, used in place of a pointer to data member.
+ * @tparam T The aggregate type.
+ * @tparam I The index of the field in declaration order.
+ */
+template <typename T, std::size_t I>
+struct AggregateField {
+  template <typename Obj>
+    requires std::derived_from<std::remove_cvref_t<Obj>, T>
+  [[nodiscard]] constexpr auto& operator()(Obj& object) const noexcept {
+    using object_type = std::conditional_t<std::is_const_v<Obj>, const T, T>;
+    return std::get<I>(TieFields<kAggregateFieldCount<T>>(static_cast<object_type&>(object)));
+  }
+};
+
+template <typename T, std::size_t I>
+struct MemberTraits<AggregateField<T, I>> {
+  using value_type = std::remove_reference_t<std::tuple_element_t<I, AggregateFieldsType<T>>>;
+  using pointer_type = AggregateField<T, I>;
+  using class_type = T;
+
+  static constexpr bool kIsDataMember = true;
+  static constexpr bool kIsFunctionMember = false;
+  static constexpr bool kIsConstMember = std::is_const_v<value_type>;
+
+  template <typename Obj>
+    requires std::derived_from<std::remove_reference_t<Obj>, T>
+  [[nodiscard]] static constexpr const value_type& Get(const Obj& object, pointer_type member) noexcept {
+    return member(object);
+  }
+
+  template <typename Obj>
+    requires std::derived_from<std::remove_reference_t<Obj>, T>
+  [[nodiscard]] static constexpr value_type& Get(Obj& object, pointer_type member) noexcept {
+    return member(object);
+  }
+
+  template <typename Obj, typename Value>
+    requires std::derived_from<std::remove_reference_t<Obj>, T> && std::convertible_to<Value&&, value_type> &&
+             (!std::is_const_v<value_type>)
+  static constexpr void Set(Obj& object, pointer_type member,
+                            Value&& value) noexcept(std::is_nothrow_assignable_v<value_type&, Value&&>) {
+    Get(object, member) = std::forward<Value>(value);
+  }
+};
+
+// Template parameter objects of class type are const
+template <typename T, std::size_t I>
+struct MemberTraits<const AggregateField<T, I>> : MemberTraits<AggregateField<T, I>> {};
+
+template <typename T>
+struct FakeObject {
+  const T value;
+};
+
+// Never defined. Only the addresses of its fields are used, to name them through the pretty function.
+template <typename T>
+extern const FakeObject<T> kFakeObject;
+
+template <typename... Bindings>
+constexpr bool kHasReference = (std::is_reference_v<Bindings> || ...);
+
+// True if no field is a reference or a bit-field, whose address cannot be taken. Only instantiated once the field
+// count is known to match the number of structured bindings, since a mismatch is a hard error.
+template <std::size_t N, typename T>
+[[nodiscard]] consteval bool HasPlainFields() noexcept {
+  if constexpr (N == 1) {
+    auto& [f0] = kFakeObject<T>.value;
+    return !kHasReference<decltype(f0)> && requires { &f0; };
+  } else if constexpr (N == 2) {
+    auto& [f0, f1] = kFakeObject<T>.value;
+    return !kHasReference<decltype(f0), decltype(f1)> && requires { &f0; &f1; };
+  } else if constexpr (N == 3) {
+    auto& [f0, f1, f2] = kFakeObject<T>.value;
+    return !kHasReference<decltype(f0), decltype(f1), decltype(f2)> && requires { &f0; &f1; &f2; };
+  } else if constexpr (N == 4) {
+    auto& [f0, f1, f2, f3] = kFakeObject<T>.value;
+    return !kHasReference<decltype(f0), decltype(f1), decltype(f2), decltype(f3)> && requires { &f0; &f1; &f2; &f3; };
+  } else if constexpr (N == 5) {
+    auto& [f0, f1, f2, f3, f4] = kFakeObject<T>.value;
+    return !kHasReference<decltype(f0), decltype(f1), decltype(f2), decltype(f3), decltype(f4)> &&
+           requires { &f0; &f1; &f2; &f3; &f4; };
+  } else if constexpr (N == 6) {
+    auto& [f0, f1, f2, f3, f4, f5] = kFakeObject<T>.value;
+    return !kHasReference<decltype(f0), decltype(f1), decltype(f2), decltype(f3), decltype(f4), decltype(f5)> &&
+           requires { &f0; &f1; &f2; &f3; &f4; &f5; };
+  } else if constexpr (N == 7) {
+    auto& [f0, f1, f2, f3, f4, f5, f6] = kFakeObject<T>.value;
+    return !kHasReference<decltype(f0), decltype(f1), decltype(f2), decltype(f3), decltype(f4), decltype(f5),
+                            decltype(f6)> &&
+           requires { &f0; &f1; &f2; &f3; &f4; &f5; &f6; };
+  } else if constexpr (N == 8) {
+    auto& [f0, f1, f2, f3, f4, f5, f6, f7] = kFakeObject<T>.value;
+    return !kHasReference<decltype(f0), decltype(f1), decltype(f2), decltype(f3), decltype(f4), decltype(f5),
+                            decltype(f6), decltype(f7)> &&
+           requires { &f0; &f1; &f2; &f3; &f4; &f5; &f6; &f7; };
+  } else if constexpr (N == 9) {
+    auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8] = kFakeObject<T>.value;
+    return !kHasReference<decltype(f0), decltype(f1), decltype(f2), decltype(f3), decltype(f4), decltype(f5),
+                            decltype(f6), decltype(f7), decltype(f8)> &&
+           requires { &f0; &f1; &f2; &f3; &f4; &f5; &f6; &f7; &f8; };
+  } else if constexpr (N == 10) {
+    auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9] = kFakeObject<T>.value;
+    return !kHasReference<decltype(f0), decltype(f1), decltype(f2), decltype(f3), decltype(f4), decltype(f5),
+                            decltype(f6), decltype(f7), decltype(f8), decltype(f9)> &&
+           requires { &f0; &f1; &f2; &f3; &f4; &f5; &f6; &f7; &f8; &f9; };
+  } else if constexpr (N == 11) {
+    auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10] = kFakeObject<T>.value;
+    return !kHasReference<decltype(f0), decltype(f1), decltype(f2), decltype(f3), decltype(f4), decltype(f5),
+                            decltype(f6), decltype(f7), decltype(f8), decltype(f9), decltype(f10)> &&
+           requires { &f0; &f1; &f2; &f3; &f4; &f5; &f6; &f7; &f8; &f9; &f10; };
+  } else if constexpr (N == 12) {
+    auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11] = kFakeObject<T>.value;
+    return !kHasReference<decltype(f0), decltype(f1), decltype(f2), decltype(f3), decltype(f4), decltype(f5),
+                            decltype(f6), decltype(f7), decltype(f8), decltype(f9), decltype(f10), decltype(f11)> &&
+           requires { &f0; &f1; &f2; &f3; &f4; &f5; &f6; &f7; &f8; &f9; &f10; &f11; };
+  } else if constexpr (N == 13) {
+    auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12] = kFakeObject<T>.value;
+    return !kHasReference<decltype(f0), decltype(f1), decltype(f2), decltype(f3), decltype(f4), decltype(f5),
+                            decltype(f6), decltype(f7), decltype(f8), decltype(f9), decltype(f10), decltype(f11),
+                            decltype(f12)> &&
+           requires { &f0; &f1; &f2; &f3; &f4; &f5; &f6; &f7; &f8; &f9; &f10; &f11; &f12; };
+  } else if constexpr (N == 14) {
+    auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13] = kFakeObject<T>.value;
+    return !kHasReference<decltype(f0), decltype(f1), decltype(f2), decltype(f3), decltype(f4), decltype(f5),
+                            decltype(f6), decltype(f7), decltype(f8), decltype(f9), decltype(f10), decltype(f11),
+                            decltype(f12), decltype(f13)> &&
+           requires { &f0; &f1; &f2; &f3; &f4; &f5; &f6; &f7; &f8; &f9; &f10; &f11; &f12; &f13; };
+  } else if constexpr (N == 15) {
+    auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14] = kFakeObject<T>.value;
+    return !kHasReference<decltype(f0), decltype(f1), decltype(f2), decltype(f3), decltype(f4), decltype(f5),
+                            decltype(f6), decltype(f7), decltype(f8), decltype(f9), decltype(f10), decltype(f11),
+                            decltype(f12), decltype(f13), decltype(f14)> &&
+           requires { &f0; &f1; &f2; &f3; &f4; &f5; &f6; &f7; &f8; &f9; &f10; &f11; &f12; &f13; &f14; };
+  } else if constexpr (N == 16) {
+    auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15] = kFakeObject<T>.value;
+    return !kHasReference<decltype(f0), decltype(f1), decltype(f2), decltype(f3), decltype(f4), decltype(f5),
+                            decltype(f6), decltype(f7), decltype(f8), decltype(f9), decltype(f10), decltype(f11),
+                            decltype(f12), decltype(f13), decltype(f14), decltype(f15)> &&
+           requires { &f0; &f1; &f2; &f3; &f4; &f5; &f6; &f7; &f8; &f9; &f10; &f11; &f12; &f13; &f14; &f15; };
+  } else if constexpr (N == 17) {
+    auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16] = kFakeObject<T>.value;
+    return !kHasReference<decltype(f0), decltype(f1), decltype(f2), decltype(f3), decltype(f4), decltype(f5),
+                            decltype(f6), decltype(f7), decltype(f8), decltype(f9), decltype(f10), decltype(f11),
+                            decltype(f12), decltype(f13), decltype(f14), decltype(f15), decltype(f16)> &&
+           requires { &f0; &f1; &f2; &f3; &f4; &f5; &f6; &f7; &f8; &f9; &f10; &f11; &f12; &f13; &f14; &f15; &f16; };
+  } else if constexpr (N == 18) {
+    auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17] = kFakeObject<T>.value;
+    return !kHasReference<decltype(f0), decltype(f1), decltype(f2), decltype(f3), decltype(f4), decltype(f5),
+                            decltype(f6), decltype(f7), decltype(f8), decltype(f9), decltype(f10), decltype(f11),
+                            decltype(f12), decltype(f13), decltype(f14), decltype(f15), decltype(f16), decltype(f17)> &&
+           requires { &f0; &f1; &f2; &f3; &f4; &f5; &f6; &f7; &f8; &f9; &f10; &f11; &f12; &f13; &f14; &f15; &f16;
+                      &f17; };
+  } else if constexpr (N == 19) {
+    auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18] = kFakeObject<T>.value;
+    return !kHasReference<decltype(f0), decltype(f1), decltype(f2), decltype(f3), decltype(f4), decltype(f5),
+                            decltype(f6), decltype(f7), decltype(f8), decltype(f9), decltype(f10), decltype(f11),
+                            decltype(f12), decltype(f13), decltype(f14), decltype(f15), decltype(f16), decltype(f17),
+                            decltype(f18)> &&
+           requires { &f0; &f1; &f2; &f3; &f4; &f5; &f6; &f7; &f8; &f9; &f10; &f11; &f12; &f13; &f14; &f15; &f16; &f17;
+                      &f18; };
+  } else if constexpr (N == 20) {
+    auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18,
+           f19] = kFakeObject<T>.value;
+    return !kHasReference<decltype(f0), decltype(f1), decltype(f2), decltype(f3), decltype(f4), decltype(f5),
+                            decltype(f6), decltype(f7), decltype(f8), decltype(f9), decltype(f10), decltype(f11),
+                            decltype(f12), decltype(f13), decltype(f14), decltype(f15), decltype(f16), decltype(f17),
+                            decltype(f18), decltype(f19)> &&
+           requires { &f0; &f1; &f2; &f3; &f4; &f5; &f6; &f7; &f8; &f9; &f10; &f11; &f12; &f13; &f14; &f15; &f16; &f17;
+                      &f18; &f19; };
+  } else if constexpr (N == 21) {
+    auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19,
+           f20] = kFakeObject<T>.value;
+    return !kHasReference<decltype(f0), decltype(f1), decltype(f2), decltype(f3), decltype(f4), decltype(f5),
+                            decltype(f6), decltype(f7), decltype(f8), decltype(f9), decltype(f10), decltype(f11),
+                            decltype(f12), decltype(f13), decltype(f14), decltype(f15), decltype(f16), decltype(f17),
+                            decltype(f18), decltype(f19), decltype(f20)> &&
+           requires { &f0; &f1; &f2; &f3; &f4; &f5; &f6; &f7; &f8; &f9; &f10; &f11; &f12; &f13; &f14; &f15; &f16; &f17;
+                      &f18; &f19; &f20; };
+  } else if constexpr (N == 22) {
+    auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20,
+           f21] = kFakeObject<T>.value;
+    return !kHasReference<decltype(f0), decltype(f1), decltype(f2), decltype(f3), decltype(f4), decltype(f5),
+                            decltype(f6), decltype(f7), decltype(f8), decltype(f9), decltype(f10), decltype(f11),
+                            decltype(f12), decltype(f13), decltype(f14), decltype(f15), decltype(f16), decltype(f17),
+                            decltype(f18), decltype(f19), decltype(f20), decltype(f21)> &&
+           requires { &f0; &f1; &f2; &f3; &f4; &f5; &f6; &f7; &f8; &f9; &f10; &f11; &f12; &f13; &f14; &f15; &f16; &f17;
+                      &f18; &f19; &f20; &f21; };
+  } else if constexpr (N == 23) {
+    auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21,
+           f22] = kFakeObject<T>.value;
+    return !kHasReference<decltype(f0), decltype(f1), decltype(f2), decltype(f3), decltype(f4), decltype(f5),
+                            decltype(f6), decltype(f7), decltype(f8), decltype(f9), decltype(f10), decltype(f11),
+                            decltype(f12), decltype(f13), decltype(f14), decltype(f15), decltype(f16), decltype(f17),
+                            decltype(f18), decltype(f19), decltype(f20), decltype(f21), decltype(f22)> &&
+           requires { &f0; &f1; &f2; &f3; &f4; &f5; &f6; &f7; &f8; &f9; &f10; &f11; &f12; &f13; &f14; &f15; &f16; &f17;
+                      &f18; &f19; &f20; &f21; &f22; };
+  } else if constexpr (N == 24) {
+    auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22,
+           f23] = kFakeObject<T>.value;
+    return !kHasReference<decltype(f0), decltype(f1), decltype(f2), decltype(f3), decltype(f4), decltype(f5),
+                            decltype(f6), decltype(f7), decltype(f8), decltype(f9), decltype(f10), decltype(f11),
+                            decltype(f12), decltype(f13), decltype(f14), decltype(f15), decltype(f16), decltype(f17),
+                            decltype(f18), decltype(f19), decltype(f20), decltype(f21), decltype(f22), decltype(f23)> &&
+           requires { &f0; &f1; &f2; &f3; &f4; &f5; &f6; &f7; &f8; &f9; &f10; &f11; &f12; &f13; &f14; &f15; &f16; &f17;
+                      &f18; &f19; &f20; &f21; &f22; &f23; };
+  } else if constexpr (N == 25) {
+    auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23,
+           f24] = kFakeObject<T>.value;
+    return !kHasReference<decltype(f0), decltype(f1), decltype(f2), decltype(f3), decltype(f4), decltype(f5),
+                            decltype(f6), decltype(f7), decltype(f8), decltype(f9), decltype(f10), decltype(f11),
+                            decltype(f12), decltype(f13), decltype(f14), decltype(f15), decltype(f16), decltype(f17),
+                            decltype(f18), decltype(f19), decltype(f20), decltype(f21), decltype(f22), decltype(f23),
+                            decltype(f24)> &&
+           requires { &f0; &f1; &f2; &f3; &f4; &f5; &f6; &f7; &f8; &f9; &f10; &f11; &f12; &f13; &f14; &f15; &f16; &f17;
+                      &f18; &f19; &f20; &f21; &f22; &f23; &f24; };
+  } else if constexpr (N == 26) {
+    auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23,
+           f24, f25] = kFakeObject<T>.value;
+    return !kHasReference<decltype(f0), decltype(f1), decltype(f2), decltype(f3), decltype(f4), decltype(f5),
+                            decltype(f6), decltype(f7), decltype(f8), decltype(f9), decltype(f10), decltype(f11),
+                            decltype(f12), decltype(f13), decltype(f14), decltype(f15), decltype(f16), decltype(f17),
+                            decltype(f18), decltype(f19), decltype(f20), decltype(f21), decltype(f22), decltype(f23),
+                            decltype(f24), decltype(f25)> &&
+           requires { &f0; &f1; &f2; &f3; &f4; &f5; &f6; &f7; &f8; &f9; &f10; &f11; &f12; &f13; &f14; &f15; &f16; &f17;
+                      &f18; &f19; &f20; &f21; &f22; &f23; &f24; &f25; };
+  } else if constexpr (N == 27) {
+    auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23,
+           f24, f25, f26] = kFakeObject<T>.value;
+    return !kHasReference<decltype(f0), decltype(f1), decltype(f2), decltype(f3), decltype(f4), decltype(f5),
+                            decltype(f6), decltype(f7), decltype(f8), decltype(f9), decltype(f10), decltype(f11),
+                            decltype(f12), decltype(f13), decltype(f14), decltype(f15), decltype(f16), decltype(f17),
+                            decltype(f18), decltype(f19), decltype(f20), decltype(f21), decltype(f22), decltype(f23),
+                            decltype(f24), decltype(f25), decltype(f26)> &&
+           requires { &f0; &f1; &f2; &f3; &f4; &f5; &f6; &f7; &f8; &f9; &f10; &f11; &f12; &f13; &f14; &f15; &f16; &f17;
+                      &f18; &f19; &f20; &f21; &f22; &f23; &f24; &f25; &f26; };
+  } else if constexpr (N == 28) {
+    auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23,
+           f24, f25, f26, f27] = kFakeObject<T>.value;
+    return !kHasReference<decltype(f0), decltype(f1), decltype(f2), decltype(f3), decltype(f4), decltype(f5),
+                            decltype(f6), decltype(f7), decltype(f8), decltype(f9), decltype(f10), decltype(f11),
+                            decltype(f12), decltype(f13), decltype(f14), decltype(f15), decltype(f16), decltype(f17),
+                            decltype(f18), decltype(f19), decltype(f20), decltype(f21), decltype(f22), decltype(f23),
+                            decltype(f24), decltype(f25), decltype(f26), decltype(f27)> &&
+           requires { &f0; &f1; &f2; &f3; &f4; &f5; &f6; &f7; &f8; &f9; &f10; &f11; &f12; &f13; &f14; &f15; &f16; &f17;
+                      &f18; &f19; &f20; &f21; &f22; &f23; &f24; &f25; &f26; &f27; };
+  } else if constexpr (N == 29) {
+    auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23,
+           f24, f25, f26, f27, f28] = kFakeObject<T>.value;
+    return !kHasReference<decltype(f0), decltype(f1), decltype(f2), decltype(f3), decltype(f4), decltype(f5),
+                            decltype(f6), decltype(f7), decltype(f8), decltype(f9), decltype(f10), decltype(f11),
+                            decltype(f12), decltype(f13), decltype(f14), decltype(f15), decltype(f16), decltype(f17),
+                            decltype(f18), decltype(f19), decltype(f20), decltype(f21), decltype(f22), decltype(f23),
+                            decltype(f24), decltype(f25), decltype(f26), decltype(f27), decltype(f28)> &&
+           requires { &f0; &f1; &f2; &f3; &f4; &f5; &f6; &f7; &f8; &f9; &f10; &f11; &f12; &f13; &f14; &f15; &f16; &f17;
+                      &f18; &f19; &f20; &f21; &f22; &f23; &f24; &f25; &f26; &f27; &f28; };
+  } else if constexpr (N == 30) {
+    auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23,
+           f24, f25, f26, f27, f28, f29] = kFakeObject<T>.value;
+    return !kHasReference<decltype(f0), decltype(f1), decltype(f2), decltype(f3), decltype(f4), decltype(f5),
+                            decltype(f6), decltype(f7), decltype(f8), decltype(f9), decltype(f10), decltype(f11),
+                            decltype(f12), decltype(f13), decltype(f14), decltype(f15), decltype(f16), decltype(f17),
+                            decltype(f18), decltype(f19), decltype(f20), decltype(f21), decltype(f22), decltype(f23),
+                            decltype(f24), decltype(f25), decltype(f26), decltype(f27), decltype(f28), decltype(f29)> &&
+           requires { &f0; &f1; &f2; &f3; &f4; &f5; &f6; &f7; &f8; &f9; &f10; &f11; &f12; &f13; &f14; &f15; &f16; &f17;
+                      &f18; &f19; &f20; &f21; &f22; &f23; &f24; &f25; &f26; &f27; &f28; &f29; };
+  } else if constexpr (N == 31) {
+    auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23,
+           f24, f25, f26, f27, f28, f29, f30] = kFakeObject<T>.value;
+    return !kHasReference<decltype(f0), decltype(f1), decltype(f2), decltype(f3), decltype(f4), decltype(f5),
+                            decltype(f6), decltype(f7), decltype(f8), decltype(f9), decltype(f10), decltype(f11),
+                            decltype(f12), decltype(f13), decltype(f14), decltype(f15), decltype(f16), decltype(f17),
+                            decltype(f18), decltype(f19), decltype(f20), decltype(f21), decltype(f22), decltype(f23),
+                            decltype(f24), decltype(f25), decltype(f26), decltype(f27), decltype(f28), decltype(f29),
+                            decltype(f30)> &&
+           requires { &f0; &f1; &f2; &f3; &f4; &f5; &f6; &f7; &f8; &f9; &f10; &f11; &f12; &f13; &f14; &f15; &f16; &f17;
+                      &f18; &f19; &f20; &f21; &f22; &f23; &f24; &f25; &f26; &f27; &f28; &f29; &f30; };
+  } else if constexpr (N == 32) {
+    auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23,
+           f24, f25, f26, f27, f28, f29, f30, f31] = kFakeObject<T>.value;
+    return !kHasReference<decltype(f0), decltype(f1), decltype(f2), decltype(f3), decltype(f4), decltype(f5),
+                            decltype(f6), decltype(f7), decltype(f8), decltype(f9), decltype(f10), decltype(f11),
+                            decltype(f12), decltype(f13), decltype(f14), decltype(f15), decltype(f16), decltype(f17),
+                            decltype(f18), decltype(f19), decltype(f20), decltype(f21), decltype(f22), decltype(f23),
+                            decltype(f24), decltype(f25), decltype(f26), decltype(f27), decltype(f28), decltype(f29),
+                            decltype(f30), decltype(f31)> &&
+           requires { &f0; &f1; &f2; &f3; &f4; &f5; &f6; &f7; &f8; &f9; &f10; &f11; &f12; &f13; &f14; &f15; &f16; &f17;
+                      &f18; &f19; &f20; &f21; &f22; &f23; &f24; &f25; &f26; &f27; &f28; &f29; &f30; &f31; };
+  } else if constexpr (N == 33) {
+    auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23,
+           f24, f25, f26, f27, f28, f29, f30, f31, f32] = kFakeObject<T>.value;
+    return !kHasReference<decltype(f0), decltype(f1), decltype(f2), decltype(f3), decltype(f4), decltype(f5),
+                            decltype(f6), decltype(f7), decltype(f8), decltype(f9), decltype(f10), decltype(f11),
+                            decltype(f12), decltype(f13), decltype(f14), decltype(f15), decltype(f16), decltype(f17),
+                            decltype(f18), decltype(f19), decltype(f20), decltype(f21), decltype(f22), decltype(f23),
+                            decltype(f24), decltype(f25), decltype(f26), decltype(f27), decltype(f28), decltype(f29),
+                            decltype(f30), decltype(f31), decltype(f32)> &&
+           requires { &f0; &f1; &f2; &f3; &f4; &f5; &f6; &f7; &f8; &f9; &f10; &f11; &f12; &f13; &f14; &f15; &f16; &f17;
+                      &f18; &f19; &f20; &f21; &f22; &f23; &f24; &f25; &f26; &f27; &f28; &f29; &f30; &f31; &f32; };
+  } else if constexpr (N == 34) {
+    auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23,
+           f24, f25, f26, f27, f28, f29, f30, f31, f32, f33] = kFakeObject<T>.value;
+    return !kHasReference<decltype(f0), decltype(f1), decltype(f2), decltype(f3), decltype(f4), decltype(f5),
+                            decltype(f6), decltype(f7), decltype(f8), decltype(f9), decltype(f10), decltype(f11),
+                            decltype(f12), decltype(f13), decltype(f14), decltype(f15), decltype(f16), decltype(f17),
+                            decltype(f18), decltype(f19), decltype(f20), decltype(f21), decltype(f22), decltype(f23),
+                            decltype(f24), decltype(f25), decltype(f26), decltype(f27), decltype(f28), decltype(f29),
+                            decltype(f30), decltype(f31), decltype(f32), decltype(f33)> &&
+           requires { &f0; &f1; &f2; &f3; &f4; &f5; &f6; &f7; &f8; &f9; &f10; &f11; &f12; &f13; &f14; &f15; &f16; &f17;
+                      &f18; &f19; &f20; &f21; &f22; &f23; &f24; &f25; &f26; &f27; &f28; &f29; &f30; &f31; &f32; &f33; };
+  } else if constexpr (N == 35) {
+    auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23,
+           f24, f25, f26, f27, f28, f29, f30, f31, f32, f33, f34] = kFakeObject<T>.value;
+    return !kHasReference<decltype(f0), decltype(f1), decltype(f2), decltype(f3), decltype(f4), decltype(f5),
+                            decltype(f6), decltype(f7), decltype(f8), decltype(f9), decltype(f10), decltype(f11),
+                            decltype(f12), decltype(f13), decltype(f14), decltype(f15), decltype(f16), decltype(f17),
+                            decltype(f18), decltype(f19), decltype(f20), decltype(f21), decltype(f22), decltype(f23),
+                            decltype(f24), decltype(f25), decltype(f26), decltype(f27), decltype(f28), decltype(f29),
+                            decltype(f30), decltype(f31), decltype(f32), decltype(f33), decltype(f34)> &&
+           requires { &f0; &f1; &f2; &f3; &f4; &f5; &f6; &f7; &f8; &f9; &f10; &f11; &f12; &f13; &f14; &f15; &f16; &f17;
+                      &f18; &f19; &f20; &f21; &f22; &f23; &f24; &f25; &f26; &f27; &f28; &f29; &f30; &f31; &f32; &f33;
+                      &f34; };
+  } else if constexpr (N == 36) {
+    auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23,
+           f24, f25, f26, f27, f28, f29, f30, f31, f32, f33, f34, f35] = kFakeObject<T>.value;
+    return !kHasReference<decltype(f0), decltype(f1), decltype(f2), decltype(f3), decltype(f4), decltype(f5),
+                            decltype(f6), decltype(f7), decltype(f8), decltype(f9), decltype(f10), decltype(f11),
+                            decltype(f12), decltype(f13), decltype(f14), decltype(f15), decltype(f16), decltype(f17),
+                            decltype(f18), decltype(f19), decltype(f20), decltype(f21), decltype(f22), decltype(f23),
+                            decltype(f24), decltype(f25), decltype(f26), decltype(f27), decltype(f28), decltype(f29),
+                            decltype(f30), decltype(f31), decltype(f32), decltype(f33), decltype(f34), decltype(f35)> &&
+           requires { &f0; &f1; &f2; &f3; &f4; &f5; &f6; &f7; &f8; &f9; &f10; &f11; &f12; &f13; &f14; &f15; &f16; &f17;
+                      &f18; &f19; &f20; &f21; &f22; &f23; &f24; &f25; &f26; &f27; &f28; &f29; &f30; &f31; &f32; &f33;
+                      &f34; &f35; };
+  } else if constexpr (N == 37) {
+    auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23,
+           f24, f25, f26, f27, f28, f29, f30, f31, f32, f33, f34, f35, f36] = kFakeObject<T>.value;
+    return !kHasReference<decltype(f0), decltype(f1), decltype(f2), decltype(f3), decltype(f4), decltype(f5),
+                            decltype(f6), decltype(f7), decltype(f8), decltype(f9), decltype(f10), decltype(f11),
+                            decltype(f12), decltype(f13), decltype(f14), decltype(f15), decltype(f16), decltype(f17),
+                            decltype(f18), decltype(f19), decltype(f20), decltype(f21), decltype(f22), decltype(f23),
+                            decltype(f24), decltype(f25), decltype(f26), decltype(f27), decltype(f28), decltype(f29),
+                            decltype(f30), decltype(f31), decltype(f32), decltype(f33), decltype(f34), decltype(f35),
+                            decltype(f36)> &&
+           requires { &f0; &f1; &f2; &f3; &f4; &f5; &f6; &f7; &f8; &f9; &f10; &f11; &f12; &f13; &f14; &f15; &f16; &f17;
+                      &f18; &f19; &f20; &f21; &f22; &f23; &f24; &f25; &f26; &f27; &f28; &f29; &f30; &f31; &f32; &f33;
+                      &f34; &f35; &f36; };
+  } else if constexpr (N == 38) {
+    auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23,
+           f24, f25, f26, f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37] = kFakeObject<T>.value;
+    return !kHasReference<decltype(f0), decltype(f1), decltype(f2), decltype(f3), decltype(f4), decltype(f5),
+                            decltype(f6), decltype(f7), decltype(f8), decltype(f9), decltype(f10), decltype(f11),
+                            decltype(f12), decltype(f13), decltype(f14), decltype(f15), decltype(f16), decltype(f17),
+                            decltype(f18), decltype(f19), decltype(f20), decltype(f21), decltype(f22), decltype(f23),
+                            decltype(f24), decltype(f25), decltype(f26), decltype(f27), decltype(f28), decltype(f29),
+                            decltype(f30), decltype(f31), decltype(f32), decltype(f33), decltype(f34), decltype(f35),
+                            decltype(f36), decltype(f37)> &&
+           requires { &f0; &f1; &f2; &f3; &f4; &f5; &f6; &f7; &f8; &f9; &f10; &f11; &f12; &f13; &f14; &f15; &f16; &f17;
+                      &f18; &f19; &f20; &f21; &f22; &f23; &f24; &f25; &f26; &f27; &f28; &f29; &f30; &f31; &f32; &f33;
+                      &f34; &f35; &f36; &f37; };
+  } else if constexpr (N == 39) {
+    auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23,
+           f24, f25, f26, f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38] = kFakeObject<T>.value;
+    return !kHasReference<decltype(f0), decltype(f1), decltype(f2), decltype(f3), decltype(f4), decltype(f5),
+                            decltype(f6), decltype(f7), decltype(f8), decltype(f9), decltype(f10), decltype(f11),
+                            decltype(f12), decltype(f13), decltype(f14), decltype(f15), decltype(f16), decltype(f17),
+                            decltype(f18), decltype(f19), decltype(f20), decltype(f21), decltype(f22), decltype(f23),
+                            decltype(f24), decltype(f25), decltype(f26), decltype(f27), decltype(f28), decltype(f29),
+                            decltype(f30), decltype(f31), decltype(f32), decltype(f33), decltype(f34), decltype(f35),
+                            decltype(f36), decltype(f37), decltype(f38)> &&
+           requires { &f0; &f1; &f2; &f3; &f4; &f5; &f6; &f7; &f8; &f9; &f10; &f11; &f12; &f13; &f14; &f15; &f16; &f17;
+                      &f18; &f19; &f20; &f21; &f22; &f23; &f24; &f25; &f26; &f27; &f28; &f29; &f30; &f31; &f32; &f33;
+                      &f34; &f35; &f36; &f37; &f38; };
+  } else if constexpr (N == 40) {
+    auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23,
+           f24, f25, f26, f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39] = kFakeObject<T>.value;
+    return !kHasReference<decltype(f0), decltype(f1), decltype(f2), decltype(f3), decltype(f4), decltype(f5),
+                            decltype(f6), decltype(f7), decltype(f8), decltype(f9), decltype(f10), decltype(f11),
+                            decltype(f12), decltype(f13), decltype(f14), decltype(f15), decltype(f16), decltype(f17),
+                            decltype(f18), decltype(f19), decltype(f20), decltype(f21), decltype(f22), decltype(f23),
+                            decltype(f24), decltype(f25), decltype(f26), decltype(f27), decltype(f28), decltype(f29),
+                            decltype(f30), decltype(f31), decltype(f32), decltype(f33), decltype(f34), decltype(f35),
+                            decltype(f36), decltype(f37), decltype(f38), decltype(f39)> &&
+           requires { &f0; &f1; &f2; &f3; &f4; &f5; &f6; &f7; &f8; &f9; &f10; &f11; &f12; &f13; &f14; &f15; &f16; &f17;
+                      &f18; &f19; &f20; &f21; &f22; &f23; &f24; &f25; &f26; &f27; &f28; &f29; &f30; &f31; &f32; &f33;
+                      &f34; &f35; &f36; &f37; &f38; &f39; };
+  } else if constexpr (N == 41) {
+    auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23,
+           f24, f25, f26, f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40] = kFakeObject<T>.value;
+    return !kHasReference<decltype(f0), decltype(f1), decltype(f2), decltype(f3), decltype(f4), decltype(f5),
+                            decltype(f6), decltype(f7), decltype(f8), decltype(f9), decltype(f10), decltype(f11),
+                            decltype(f12), decltype(f13), decltype(f14), decltype(f15), decltype(f16), decltype(f17),
+                            decltype(f18), decltype(f19), decltype(f20), decltype(f21), decltype(f22), decltype(f23),
+                            decltype(f24), decltype(f25), decltype(f26), decltype(f27), decltype(f28), decltype(f29),
+                            decltype(f30), decltype(f31), decltype(f32), decltype(f33), decltype(f34), decltype(f35),
+                            decltype(f36), decltype(f37), decltype(f38), decltype(f39), decltype(f40)> &&
+           requires { &f0; &f1; &f2; &f3; &f4; &f5; &f6; &f7; &f8; &f9; &f10; &f11; &f12; &f13; &f14; &f15; &f16; &f17;
+                      &f18; &f19; &f20; &f21; &f22; &f23; &f24; &f25; &f26; &f27; &f28; &f29; &f30; &f31; &f32; &f33;
+                      &f34; &f35; &f36; &f37; &f38; &f39; &f40; };
+  } else if constexpr (N == 42) {
+    auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23,
+           f24, f25, f26, f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40,
+           f41] = kFakeObject<T>.value;
+    return !kHasReference<decltype(f0), decltype(f1), decltype(f2), decltype(f3), decltype(f4), decltype(f5),
+                            decltype(f6), decltype(f7), decltype(f8), decltype(f9), decltype(f10), decltype(f11),
+                            decltype(f12), decltype(f13), decltype(f14), decltype(f15), decltype(f16), decltype(f17),
+                            decltype(f18), decltype(f19), decltype(f20), decltype(f21), decltype(f22), decltype(f23),
+                            decltype(f24), decltype(f25), decltype(f26), decltype(f27), decltype(f28), decltype(f29),
+                            decltype(f30), decltype(f31), decltype(f32), decltype(f33), decltype(f34), decltype(f35),
+                            decltype(f36), decltype(f37), decltype(f38), decltype(f39), decltype(f40), decltype(f41)> &&
+           requires { &f0; &f1; &f2; &f3; &f4; &f5; &f6; &f7; &f8; &f9; &f10; &f11; &f12; &f13; &f14; &f15; &f16; &f17;
+                      &f18; &f19; &f20; &f21; &f22; &f23; &f24; &f25; &f26; &f27; &f28; &f29; &f30; &f31; &f32; &f33;
+                      &f34; &f35; &f36; &f37; &f38; &f39; &f40; &f41; };
+  } else if constexpr (N == 43) {
+    auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23,
+           f24, f25, f26, f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41,
+           f42] = kFakeObject<T>.value;
+    return !kHasReference<decltype(f0), decltype(f1), decltype(f2), decltype(f3), decltype(f4), decltype(f5),
+                            decltype(f6), decltype(f7), decltype(f8), decltype(f9), decltype(f10), decltype(f11),
+                            decltype(f12), decltype(f13), decltype(f14), decltype(f15), decltype(f16), decltype(f17),
+                            decltype(f18), decltype(f19), decltype(f20), decltype(f21), decltype(f22), decltype(f23),
+                            decltype(f24), decltype(f25), decltype(f26), decltype(f27), decltype(f28), decltype(f29),
+                            decltype(f30), decltype(f31), decltype(f32), decltype(f33), decltype(f34), decltype(f35),
+                            decltype(f36), decltype(f37), decltype(f38), decltype(f39), decltype(f40), decltype(f41),
+                            decltype(f42)> &&
+           requires { &f0; &f1; &f2; &f3; &f4; &f5; &f6; &f7; &f8; &f9; &f10; &f11; &f12; &f13; &f14; &f15; &f16; &f17;
+                      &f18; &f19; &f20; &f21; &f22; &f23; &f24; &f25; &f26; &f27; &f28; &f29; &f30; &f31; &f32; &f33;
+                      &f34; &f35; &f36; &f37; &f38; &f39; &f40; &f41; &f42; };
+  } else if constexpr (N == 44) {
+    auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23,
+           f24, f25, f26, f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42,
+           f43] = kFakeObject<T>.value;
+    return !kHasReference<decltype(f0), decltype(f1), decltype(f2), decltype(f3), decltype(f4), decltype(f5),
+                            decltype(f6), decltype(f7), decltype(f8), decltype(f9), decltype(f10), decltype(f11),
+                            decltype(f12), decltype(f13), decltype(f14), decltype(f15), decltype(f16), decltype(f17),
+                            decltype(f18), decltype(f19), decltype(f20), decltype(f21), decltype(f22), decltype(f23),
+                            decltype(f24), decltype(f25), decltype(f26), decltype(f27), decltype(f28), decltype(f29),
+                            decltype(f30), decltype(f31), decltype(f32), decltype(f33), decltype(f34), decltype(f35),
+                            decltype(f36), decltype(f37), decltype(f38), decltype(f39), decltype(f40), decltype(f41),
+                            decltype(f42), decltype(f43)> &&
+           requires { &f0; &f1; &f2; &f3; &f4; &f5; &f6; &f7; &f8; &f9; &f10; &f11; &f12; &f13; &f14; &f15; &f16; &f17;
+                      &f18; &f19; &f20; &f21; &f22; &f23; &f24; &f25; &f26; &f27; &f28; &f29; &f30; &f31; &f32; &f33;
+                      &f34; &f35; &f36; &f37; &f38; &f39; &f40; &f41; &f42; &f43; };
+  } else if constexpr (N == 45) {
+    auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23,
+           f24, f25, f26, f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43,
+           f44] = kFakeObject<T>.value;
+    return !kHasReference<decltype(f0), decltype(f1), decltype(f2), decltype(f3), decltype(f4), decltype(f5),
+                            decltype(f6), decltype(f7), decltype(f8), decltype(f9), decltype(f10), decltype(f11),
+                            decltype(f12), decltype(f13), decltype(f14), decltype(f15), decltype(f16), decltype(f17),
+                            decltype(f18), decltype(f19), decltype(f20), decltype(f21), decltype(f22), decltype(f23),
+                            decltype(f24), decltype(f25), decltype(f26), decltype(f27), decltype(f28), decltype(f29),
+                            decltype(f30), decltype(f31), decltype(f32), decltype(f33), decltype(f34), decltype(f35),
+                            decltype(f36), decltype(f37), decltype(f38), decltype(f39), decltype(f40), decltype(f41),
+                            decltype(f42), decltype(f43), decltype(f44)> &&
+           requires { &f0; &f1; &f2; &f3; &f4; &f5; &f6; &f7; &f8; &f9; &f10; &f11; &f12; &f13; &f14; &f15; &f16; &f17;
+                      &f18; &f19; &f20; &f21; &f22; &f23; &f24; &f25; &f26; &f27; &f28; &f29; &f30; &f31; &f32; &f33;
+                      &f34; &f35; &f36; &f37; &f38; &f39; &f40; &f41; &f42; &f43; &f44; };
+  } else if constexpr (N == 46) {
+    auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23,
+           f24, f25, f26, f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44,
+           f45] = kFakeObject<T>.value;
+    return !kHasReference<decltype(f0), decltype(f1), decltype(f2), decltype(f3), decltype(f4), decltype(f5),
+                            decltype(f6), decltype(f7), decltype(f8), decltype(f9), decltype(f10), decltype(f11),
+                            decltype(f12), decltype(f13), decltype(f14), decltype(f15), decltype(f16), decltype(f17),
+                            decltype(f18), decltype(f19), decltype(f20), decltype(f21), decltype(f22), decltype(f23),
+                            decltype(f24), decltype(f25), decltype(f26), decltype(f27), decltype(f28), decltype(f29),
+                            decltype(f30), decltype(f31), decltype(f32), decltype(f33), decltype(f34), decltype(f35),
+                            decltype(f36), decltype(f37), decltype(f38), decltype(f39), decltype(f40), decltype(f41),
+                            decltype(f42), decltype(f43), decltype(f44), decltype(f45)> &&
+           requires { &f0; &f1; &f2; &f3; &f4; &f5; &f6; &f7; &f8; &f9; &f10; &f11; &f12; &f13; &f14; &f15; &f16; &f17;
+                      &f18; &f19; &f20; &f21; &f22; &f23; &f24; &f25; &f26; &f27; &f28; &f29; &f30; &f31; &f32; &f33;
+                      &f34; &f35; &f36; &f37; &f38; &f39; &f40; &f41; &f42; &f43; &f44; &f45; };
+  } else if constexpr (N == 47) {
+    auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23,
+           f24, f25, f26, f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44, f45,
+           f46] = kFakeObject<T>.value;
+    return !kHasReference<decltype(f0), decltype(f1), decltype(f2), decltype(f3), decltype(f4), decltype(f5),
+                            decltype(f6), decltype(f7), decltype(f8), decltype(f9), decltype(f10), decltype(f11),
+                            decltype(f12), decltype(f13), decltype(f14), decltype(f15), decltype(f16), decltype(f17),
+                            decltype(f18), decltype(f19), decltype(f20), decltype(f21), decltype(f22), decltype(f23),
+                            decltype(f24), decltype(f25), decltype(f26), decltype(f27), decltype(f28), decltype(f29),
+                            decltype(f30), decltype(f31), decltype(f32), decltype(f33), decltype(f34), decltype(f35),
+                            decltype(f36), decltype(f37), decltype(f38), decltype(f39), decltype(f40), decltype(f41),
+                            decltype(f42), decltype(f43), decltype(f44), decltype(f45), decltype(f46)> &&
+           requires { &f0; &f1; &f2; &f3; &f4; &f5; &f6; &f7; &f8; &f9; &f10; &f11; &f12; &f13; &f14; &f15; &f16; &f17;
+                      &f18; &f19; &f20; &f21; &f22; &f23; &f24; &f25; &f26; &f27; &f28; &f29; &f30; &f31; &f32; &f33;
+                      &f34; &f35; &f36; &f37; &f38; &f39; &f40; &f41; &f42; &f43; &f44; &f45; &f46; };
+  } else if constexpr (N == 48) {
+    auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23,
+           f24, f25, f26, f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44, f45,
+           f46, f47] = kFakeObject<T>.value;
+    return !kHasReference<decltype(f0), decltype(f1), decltype(f2), decltype(f3), decltype(f4), decltype(f5),
+                            decltype(f6), decltype(f7), decltype(f8), decltype(f9), decltype(f10), decltype(f11),
+                            decltype(f12), decltype(f13), decltype(f14), decltype(f15), decltype(f16), decltype(f17),
+                            decltype(f18), decltype(f19), decltype(f20), decltype(f21), decltype(f22), decltype(f23),
+                            decltype(f24), decltype(f25), decltype(f26), decltype(f27), decltype(f28), decltype(f29),
+                            decltype(f30), decltype(f31), decltype(f32), decltype(f33), decltype(f34), decltype(f35),
+                            decltype(f36), decltype(f37), decltype(f38), decltype(f39), decltype(f40), decltype(f41),
+                            decltype(f42), decltype(f43), decltype(f44), decltype(f45), decltype(f46), decltype(f47)> &&
+           requires { &f0; &f1; &f2; &f3; &f4; &f5; &f6; &f7; &f8; &f9; &f10; &f11; &f12; &f13; &f14; &f15; &f16; &f17;
+                      &f18; &f19; &f20; &f21; &f22; &f23; &f24; &f25; &f26; &f27; &f28; &f29; &f30; &f31; &f32; &f33;
+                      &f34; &f35; &f36; &f37; &f38; &f39; &f40; &f41; &f42; &f43; &f44; &f45; &f46; &f47; };
+  } else if constexpr (N == 49) {
+    auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23,
+           f24, f25, f26, f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44, f45,
+           f46, f47, f48] = kFakeObject<T>.value;
+    return !kHasReference<decltype(f0), decltype(f1), decltype(f2), decltype(f3), decltype(f4), decltype(f5),
+                            decltype(f6), decltype(f7), decltype(f8), decltype(f9), decltype(f10), decltype(f11),
+                            decltype(f12), decltype(f13), decltype(f14), decltype(f15), decltype(f16), decltype(f17),
+                            decltype(f18), decltype(f19), decltype(f20), decltype(f21), decltype(f22), decltype(f23),
+                            decltype(f24), decltype(f25), decltype(f26), decltype(f27), decltype(f28), decltype(f29),
+                            decltype(f30), decltype(f31), decltype(f32), decltype(f33), decltype(f34), decltype(f35),
+                            decltype(f36), decltype(f37), decltype(f38), decltype(f39), decltype(f40), decltype(f41),
+                            decltype(f42), decltype(f43), decltype(f44), decltype(f45), decltype(f46), decltype(f47),
+                            decltype(f48)> &&
+           requires { &f0; &f1; &f2; &f3; &f4; &f5; &f6; &f7; &f8; &f9; &f10; &f11; &f12; &f13; &f14; &f15; &f16; &f17;
+                      &f18; &f19; &f20; &f21; &f22; &f23; &f24; &f25; &f26; &f27; &f28; &f29; &f30; &f31; &f32; &f33;
+                      &f34; &f35; &f36; &f37; &f38; &f39; &f40; &f41; &f42; &f43; &f44; &f45; &f46; &f47; &f48; };
+  } else if constexpr (N == 50) {
+    auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23,
+           f24, f25, f26, f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44, f45,
+           f46, f47, f48, f49] = kFakeObject<T>.value;
+    return !kHasReference<decltype(f0), decltype(f1), decltype(f2), decltype(f3), decltype(f4), decltype(f5),
+                            decltype(f6), decltype(f7), decltype(f8), decltype(f9), decltype(f10), decltype(f11),
+                            decltype(f12), decltype(f13), decltype(f14), decltype(f15), decltype(f16), decltype(f17),
+                            decltype(f18), decltype(f19), decltype(f20), decltype(f21), decltype(f22), decltype(f23),
+                            decltype(f24), decltype(f25), decltype(f26), decltype(f27), decltype(f28), decltype(f29),
+                            decltype(f30), decltype(f31), decltype(f32), decltype(f33), decltype(f34), decltype(f35),
+                            decltype(f36), decltype(f37), decltype(f38), decltype(f39), decltype(f40), decltype(f41),
+                            decltype(f42), decltype(f43), decltype(f44), decltype(f45), decltype(f46), decltype(f47),
+                            decltype(f48), decltype(f49)> &&
+           requires { &f0; &f1; &f2; &f3; &f4; &f5; &f6; &f7; &f8; &f9; &f10; &f11; &f12; &f13; &f14; &f15; &f16; &f17;
+                      &f18; &f19; &f20; &f21; &f22; &f23; &f24; &f25; &f26; &f27; &f28; &f29; &f30; &f31; &f32; &f33;
+                      &f34; &f35; &f36; &f37; &f38; &f39; &f40; &f41; &f42; &f43; &f44; &f45; &f46; &f47; &f48; &f49; };
+  } else if constexpr (N == 51) {
+    auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23,
+           f24, f25, f26, f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44, f45,
+           f46, f47, f48, f49, f50] = kFakeObject<T>.value;
+    return !kHasReference<decltype(f0), decltype(f1), decltype(f2), decltype(f3), decltype(f4), decltype(f5),
+                            decltype(f6), decltype(f7), decltype(f8), decltype(f9), decltype(f10), decltype(f11),
+                            decltype(f12), decltype(f13), decltype(f14), decltype(f15), decltype(f16), decltype(f17),
+                            decltype(f18), decltype(f19), decltype(f20), decltype(f21), decltype(f22), decltype(f23),
+                            decltype(f24), decltype(f25), decltype(f26), decltype(f27), decltype(f28), decltype(f29),
+                            decltype(f30), decltype(f31), decltype(f32), decltype(f33), decltype(f34), decltype(f35),
+                            decltype(f36), decltype(f37), decltype(f38), decltype(f39), decltype(f40), decltype(f41),
+                            decltype(f42), decltype(f43), decltype(f44), decltype(f45), decltype(f46), decltype(f47),
+                            decltype(f48), decltype(f49), decltype(f50)> &&
+           requires { &f0; &f1; &f2; &f3; &f4; &f5; &f6; &f7; &f8; &f9; &f10; &f11; &f12; &f13; &f14; &f15; &f16; &f17;
+                      &f18; &f19; &f20; &f21; &f22; &f23; &f24; &f25; &f26; &f27; &f28; &f29; &f30; &f31; &f32; &f33;
+                      &f34; &f35; &f36; &f37; &f38; &f39; &f40; &f41; &f42; &f43; &f44; &f45; &f46; &f47; &f48; &f49;
+                      &f50; };
+  } else if constexpr (N == 52) {
+    auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23,
+           f24, f25, f26, f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44, f45,
+           f46, f47, f48, f49, f50, f51] = kFakeObject<T>.value;
+    return !kHasReference<decltype(f0), decltype(f1), decltype(f2), decltype(f3), decltype(f4), decltype(f5),
+                            decltype(f6), decltype(f7), decltype(f8), decltype(f9), decltype(f10), decltype(f11),
+                            decltype(f12), decltype(f13), decltype(f14), decltype(f15), decltype(f16), decltype(f17),
+                            decltype(f18), decltype(f19), decltype(f20), decltype(f21), decltype(f22), decltype(f23),
+                            decltype(f24), decltype(f25), decltype(f26), decltype(f27), decltype(f28), decltype(f29),
+                            decltype(f30), decltype(f31), decltype(f32), decltype(f33), decltype(f34), decltype(f35),
+                            decltype(f36), decltype(f37), decltype(f38), decltype(f39), decltype(f40), decltype(f41),
+                            decltype(f42), decltype(f43), decltype(f44), decltype(f45), decltype(f46), decltype(f47),
+                            decltype(f48), decltype(f49), decltype(f50), decltype(f51)> &&
+           requires { &f0; &f1; &f2; &f3; &f4; &f5; &f6; &f7; &f8; &f9; &f10; &f11; &f12; &f13; &f14; &f15; &f16; &f17;
+                      &f18; &f19; &f20; &f21; &f22; &f23; &f24; &f25; &f26; &f27; &f28; &f29; &f30; &f31; &f32; &f33;
+                      &f34; &f35; &f36; &f37; &f38; &f39; &f40; &f41; &f42; &f43; &f44; &f45; &f46; &f47; &f48; &f49;
+                      &f50; &f51; };
+  } else if constexpr (N == 53) {
+    auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23,
+           f24, f25, f26, f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44, f45,
+           f46, f47, f48, f49, f50, f51, f52] = kFakeObject<T>.value;
+    return !kHasReference<decltype(f0), decltype(f1), decltype(f2), decltype(f3), decltype(f4), decltype(f5),
+                            decltype(f6), decltype(f7), decltype(f8), decltype(f9), decltype(f10), decltype(f11),
+                            decltype(f12), decltype(f13), decltype(f14), decltype(f15), decltype(f16), decltype(f17),
+                            decltype(f18), decltype(f19), decltype(f20), decltype(f21), decltype(f22), decltype(f23),
+                            decltype(f24), decltype(f25), decltype(f26), decltype(f27), decltype(f28), decltype(f29),
+                            decltype(f30), decltype(f31), decltype(f32), decltype(f33), decltype(f34), decltype(f35),
+                            decltype(f36), decltype(f37), decltype(f38), decltype(f39), decltype(f40), decltype(f41),
+                            decltype(f42), decltype(f43), decltype(f44), decltype(f45), decltype(f46), decltype(f47),
+                            decltype(f48), decltype(f49), decltype(f50), decltype(f51), decltype(f52)> &&
+           requires { &f0; &f1; &f2; &f3; &f4; &f5; &f6; &f7; &f8; &f9; &f10; &f11; &f12; &f13; &f14; &f15; &f16; &f17;
+                      &f18; &f19; &f20; &f21; &f22; &f23; &f24; &f25; &f26; &f27; &f28; &f29; &f30; &f31; &f32; &f33;
+                      &f34; &f35; &f36; &f37; &f38; &f39; &f40; &f41; &f42; &f43; &f44; &f45; &f46; &f47; &f48; &f49;
+                      &f50; &f51; &f52; };
+  } else if constexpr (N == 54) {
+    auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23,
+           f24, f25, f26, f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44, f45,
+           f46, f47, f48, f49, f50, f51, f52, f53] = kFakeObject<T>.value;
+    return !kHasReference<decltype(f0), decltype(f1), decltype(f2), decltype(f3), decltype(f4), decltype(f5),
+                            decltype(f6), decltype(f7), decltype(f8), decltype(f9), decltype(f10), decltype(f11),
+                            decltype(f12), decltype(f13), decltype(f14), decltype(f15), decltype(f16), decltype(f17),
+                            decltype(f18), decltype(f19), decltype(f20), decltype(f21), decltype(f22), decltype(f23),
+                            decltype(f24), decltype(f25), decltype(f26), decltype(f27), decltype(f28), decltype(f29),
+                            decltype(f30), decltype(f31), decltype(f32), decltype(f33), decltype(f34), decltype(f35),
+                            decltype(f36), decltype(f37), decltype(f38), decltype(f39), decltype(f40), decltype(f41),
+                            decltype(f42), decltype(f43), decltype(f44), decltype(f45), decltype(f46), decltype(f47),
+                            decltype(f48), decltype(f49), decltype(f50), decltype(f51), decltype(f52), decltype(f53)> &&
+           requires { &f0; &f1; &f2; &f3; &f4; &f5; &f6; &f7; &f8; &f9; &f10; &f11; &f12; &f13; &f14; &f15; &f16; &f17;
+                      &f18; &f19; &f20; &f21; &f22; &f23; &f24; &f25; &f26; &f27; &f28; &f29; &f30; &f31; &f32; &f33;
+                      &f34; &f35; &f36; &f37; &f38; &f39; &f40; &f41; &f42; &f43; &f44; &f45; &f46; &f47; &f48; &f49;
+                      &f50; &f51; &f52; &f53; };
+  } else if constexpr (N == 55) {
+    auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23,
+           f24, f25, f26, f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44, f45,
+           f46, f47, f48, f49, f50, f51, f52, f53, f54] = kFakeObject<T>.value;
+    return !kHasReference<decltype(f0), decltype(f1), decltype(f2), decltype(f3), decltype(f4), decltype(f5),
+                            decltype(f6), decltype(f7), decltype(f8), decltype(f9), decltype(f10), decltype(f11),
+                            decltype(f12), decltype(f13), decltype(f14), decltype(f15), decltype(f16), decltype(f17),
+                            decltype(f18), decltype(f19), decltype(f20), decltype(f21), decltype(f22), decltype(f23),
+                            decltype(f24), decltype(f25), decltype(f26), decltype(f27), decltype(f28), decltype(f29),
+                            decltype(f30), decltype(f31), decltype(f32), decltype(f33), decltype(f34), decltype(f35),
+                            decltype(f36), decltype(f37), decltype(f38), decltype(f39), decltype(f40), decltype(f41),
+                            decltype(f42), decltype(f43), decltype(f44), decltype(f45), decltype(f46), decltype(f47),
+                            decltype(f48), decltype(f49), decltype(f50), decltype(f51), decltype(f52), decltype(f53),
+                            decltype(f54)> &&
+           requires { &f0; &f1; &f2; &f3; &f4; &f5; &f6; &f7; &f8; &f9; &f10; &f11; &f12; &f13; &f14; &f15; &f16; &f17;
+                      &f18; &f19; &f20; &f21; &f22; &f23; &f24; &f25; &f26; &f27; &f28; &f29; &f30; &f31; &f32; &f33;
+                      &f34; &f35; &f36; &f37; &f38; &f39; &f40; &f41; &f42; &f43; &f44; &f45; &f46; &f47; &f48; &f49;
+                      &f50; &f51; &f52; &f53; &f54; };
+  } else if constexpr (N == 56) {
+    auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23,
+           f24, f25, f26, f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44, f45,
+           f46, f47, f48, f49, f50, f51, f52, f53, f54, f55] = kFakeObject<T>.value;
+    return !kHasReference<decltype(f0), decltype(f1), decltype(f2), decltype(f3), decltype(f4), decltype(f5),
+                            decltype(f6), decltype(f7), decltype(f8), decltype(f9), decltype(f10), decltype(f11),
+                            decltype(f12), decltype(f13), decltype(f14), decltype(f15), decltype(f16), decltype(f17),
+                            decltype(f18), decltype(f19), decltype(f20), decltype(f21), decltype(f22), decltype(f23),
+                            decltype(f24), decltype(f25), decltype(f26), decltype(f27), decltype(f28), decltype(f29),
+                            decltype(f30), decltype(f31), decltype(f32), decltype(f33), decltype(f34), decltype(f35),
+                            decltype(f36), decltype(f37), decltype(f38), decltype(f39), decltype(f40), decltype(f41),
+                            decltype(f42), decltype(f43), decltype(f44), decltype(f45), decltype(f46), decltype(f47),
+                            decltype(f48), decltype(f49), decltype(f50), decltype(f51), decltype(f52), decltype(f53),
+                            decltype(f54), decltype(f55)> &&
+           requires { &f0; &f1; &f2; &f3; &f4; &f5; &f6; &f7; &f8; &f9; &f10; &f11; &f12; &f13; &f14; &f15; &f16; &f17;
+                      &f18; &f19; &f20; &f21; &f22; &f23; &f24; &f25; &f26; &f27; &f28; &f29; &f30; &f31; &f32; &f33;
+                      &f34; &f35; &f36; &f37; &f38; &f39; &f40; &f41; &f42; &f43; &f44; &f45; &f46; &f47; &f48; &f49;
+                      &f50; &f51; &f52; &f53; &f54; &f55; };
+  } else if constexpr (N == 57) {
+    auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23,
+           f24, f25, f26, f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44, f45,
+           f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56] = kFakeObject<T>.value;
+    return !kHasReference<decltype(f0), decltype(f1), decltype(f2), decltype(f3), decltype(f4), decltype(f5),
+                            decltype(f6), decltype(f7), decltype(f8), decltype(f9), decltype(f10), decltype(f11),
+                            decltype(f12), decltype(f13), decltype(f14), decltype(f15), decltype(f16), decltype(f17),
+                            decltype(f18), decltype(f19), decltype(f20), decltype(f21), decltype(f22), decltype(f23),
+                            decltype(f24), decltype(f25), decltype(f26), decltype(f27), decltype(f28), decltype(f29),
+                            decltype(f30), decltype(f31), decltype(f32), decltype(f33), decltype(f34), decltype(f35),
+                            decltype(f36), decltype(f37), decltype(f38), decltype(f39), decltype(f40), decltype(f41),
+                            decltype(f42), decltype(f43), decltype(f44), decltype(f45), decltype(f46), decltype(f47),
+                            decltype(f48), decltype(f49), decltype(f50), decltype(f51), decltype(f52), decltype(f53),
+                            decltype(f54), decltype(f55), decltype(f56)> &&
+           requires { &f0; &f1; &f2; &f3; &f4; &f5; &f6; &f7; &f8; &f9; &f10; &f11; &f12; &f13; &f14; &f15; &f16; &f17;
+                      &f18; &f19; &f20; &f21; &f22; &f23; &f24; &f25; &f26; &f27; &f28; &f29; &f30; &f31; &f32; &f33;
+                      &f34; &f35; &f36; &f37; &f38; &f39; &f40; &f41; &f42; &f43; &f44; &f45; &f46; &f47; &f48; &f49;
+                      &f50; &f51; &f52; &f53; &f54; &f55; &f56; };
+  } else if constexpr (N == 58) {
+    auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23,
+           f24, f25, f26, f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44, f45,
+           f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56, f57] = kFakeObject<T>.value;
+    return !kHasReference<decltype(f0), decltype(f1), decltype(f2), decltype(f3), decltype(f4), decltype(f5),
+                            decltype(f6), decltype(f7), decltype(f8), decltype(f9), decltype(f10), decltype(f11),
+                            decltype(f12), decltype(f13), decltype(f14), decltype(f15), decltype(f16), decltype(f17),
+                            decltype(f18), decltype(f19), decltype(f20), decltype(f21), decltype(f22), decltype(f23),
+                            decltype(f24), decltype(f25), decltype(f26), decltype(f27), decltype(f28), decltype(f29),
+                            decltype(f30), decltype(f31), decltype(f32), decltype(f33), decltype(f34), decltype(f35),
+                            decltype(f36), decltype(f37), decltype(f38), decltype(f39), decltype(f40), decltype(f41),
+                            decltype(f42), decltype(f43), decltype(f44), decltype(f45), decltype(f46), decltype(f47),
+                            decltype(f48), decltype(f49), decltype(f50), decltype(f51), decltype(f52), decltype(f53),
+                            decltype(f54), decltype(f55), decltype(f56), decltype(f57)> &&
+           requires { &f0; &f1; &f2; &f3; &f4; &f5; &f6; &f7; &f8; &f9; &f10; &f11; &f12; &f13; &f14; &f15; &f16; &f17;
+                      &f18; &f19; &f20; &f21; &f22; &f23; &f24; &f25; &f26; &f27; &f28; &f29; &f30; &f31; &f32; &f33;
+                      &f34; &f35; &f36; &f37; &f38; &f39; &f40; &f41; &f42; &f43; &f44; &f45; &f46; &f47; &f48; &f49;
+                      &f50; &f51; &f52; &f53; &f54; &f55; &f56; &f57; };
+  } else if constexpr (N == 59) {
+    auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23,
+           f24, f25, f26, f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44, f45,
+           f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56, f57, f58] = kFakeObject<T>.value;
+    return !kHasReference<decltype(f0), decltype(f1), decltype(f2), decltype(f3), decltype(f4), decltype(f5),
+                            decltype(f6), decltype(f7), decltype(f8), decltype(f9), decltype(f10), decltype(f11),
+                            decltype(f12), decltype(f13), decltype(f14), decltype(f15), decltype(f16), decltype(f17),
+                            decltype(f18), decltype(f19), decltype(f20), decltype(f21), decltype(f22), decltype(f23),
+                            decltype(f24), decltype(f25), decltype(f26), decltype(f27), decltype(f28), decltype(f29),
+                            decltype(f30), decltype(f31), decltype(f32), decltype(f33), decltype(f34), decltype(f35),
+                            decltype(f36), decltype(f37), decltype(f38), decltype(f39), decltype(f40), decltype(f41),
+                            decltype(f42), decltype(f43), decltype(f44), decltype(f45), decltype(f46), decltype(f47),
+                            decltype(f48), decltype(f49), decltype(f50), decltype(f51), decltype(f52), decltype(f53),
+                            decltype(f54), decltype(f55), decltype(f56), decltype(f57), decltype(f58)> &&
+           requires { &f0; &f1; &f2; &f3; &f4; &f5; &f6; &f7; &f8; &f9; &f10; &f11; &f12; &f13; &f14; &f15; &f16; &f17;
+                      &f18; &f19; &f20; &f21; &f22; &f23; &f24; &f25; &f26; &f27; &f28; &f29; &f30; &f31; &f32; &f33;
+                      &f34; &f35; &f36; &f37; &f38; &f39; &f40; &f41; &f42; &f43; &f44; &f45; &f46; &f47; &f48; &f49;
+                      &f50; &f51; &f52; &f53; &f54; &f55; &f56; &f57; &f58; };
+  } else if constexpr (N == 60) {
+    auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23,
+           f24, f25, f26, f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44, f45,
+           f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56, f57, f58, f59] = kFakeObject<T>.value;
+    return !kHasReference<decltype(f0), decltype(f1), decltype(f2), decltype(f3), decltype(f4), decltype(f5),
+                            decltype(f6), decltype(f7), decltype(f8), decltype(f9), decltype(f10), decltype(f11),
+                            decltype(f12), decltype(f13), decltype(f14), decltype(f15), decltype(f16), decltype(f17),
+                            decltype(f18), decltype(f19), decltype(f20), decltype(f21), decltype(f22), decltype(f23),
+                            decltype(f24), decltype(f25), decltype(f26), decltype(f27), decltype(f28), decltype(f29),
+                            decltype(f30), decltype(f31), decltype(f32), decltype(f33), decltype(f34), decltype(f35),
+                            decltype(f36), decltype(f37), decltype(f38), decltype(f39), decltype(f40), decltype(f41),
+                            decltype(f42), decltype(f43), decltype(f44), decltype(f45), decltype(f46), decltype(f47),
+                            decltype(f48), decltype(f49), decltype(f50), decltype(f51), decltype(f52), decltype(f53),
+                            decltype(f54), decltype(f55), decltype(f56), decltype(f57), decltype(f58), decltype(f59)> &&
+           requires { &f0; &f1; &f2; &f3; &f4; &f5; &f6; &f7; &f8; &f9; &f10; &f11; &f12; &f13; &f14; &f15; &f16; &f17;
+                      &f18; &f19; &f20; &f21; &f22; &f23; &f24; &f25; &f26; &f27; &f28; &f29; &f30; &f31; &f32; &f33;
+                      &f34; &f35; &f36; &f37; &f38; &f39; &f40; &f41; &f42; &f43; &f44; &f45; &f46; &f47; &f48; &f49;
+                      &f50; &f51; &f52; &f53; &f54; &f55; &f56; &f57; &f58; &f59; };
+  } else if constexpr (N == 61) {
+    auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23,
+           f24, f25, f26, f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44, f45,
+           f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56, f57, f58, f59, f60] = kFakeObject<T>.value;
+    return !kHasReference<decltype(f0), decltype(f1), decltype(f2), decltype(f3), decltype(f4), decltype(f5),
+                            decltype(f6), decltype(f7), decltype(f8), decltype(f9), decltype(f10), decltype(f11),
+                            decltype(f12), decltype(f13), decltype(f14), decltype(f15), decltype(f16), decltype(f17),
+                            decltype(f18), decltype(f19), decltype(f20), decltype(f21), decltype(f22), decltype(f23),
+                            decltype(f24), decltype(f25), decltype(f26), decltype(f27), decltype(f28), decltype(f29),
+                            decltype(f30), decltype(f31), decltype(f32), decltype(f33), decltype(f34), decltype(f35),
+                            decltype(f36), decltype(f37), decltype(f38), decltype(f39), decltype(f40), decltype(f41),
+                            decltype(f42), decltype(f43), decltype(f44), decltype(f45), decltype(f46), decltype(f47),
+                            decltype(f48), decltype(f49), decltype(f50), decltype(f51), decltype(f52), decltype(f53),
+                            decltype(f54), decltype(f55), decltype(f56), decltype(f57), decltype(f58), decltype(f59),
+                            decltype(f60)> &&
+           requires { &f0; &f1; &f2; &f3; &f4; &f5; &f6; &f7; &f8; &f9; &f10; &f11; &f12; &f13; &f14; &f15; &f16; &f17;
+                      &f18; &f19; &f20; &f21; &f22; &f23; &f24; &f25; &f26; &f27; &f28; &f29; &f30; &f31; &f32; &f33;
+                      &f34; &f35; &f36; &f37; &f38; &f39; &f40; &f41; &f42; &f43; &f44; &f45; &f46; &f47; &f48; &f49;
+                      &f50; &f51; &f52; &f53; &f54; &f55; &f56; &f57; &f58; &f59; &f60; };
+  } else if constexpr (N == 62) {
+    auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23,
+           f24, f25, f26, f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44, f45,
+           f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56, f57, f58, f59, f60, f61] = kFakeObject<T>.value;
+    return !kHasReference<decltype(f0), decltype(f1), decltype(f2), decltype(f3), decltype(f4), decltype(f5),
+                            decltype(f6), decltype(f7), decltype(f8), decltype(f9), decltype(f10), decltype(f11),
+                            decltype(f12), decltype(f13), decltype(f14), decltype(f15), decltype(f16), decltype(f17),
+                            decltype(f18), decltype(f19), decltype(f20), decltype(f21), decltype(f22), decltype(f23),
+                            decltype(f24), decltype(f25), decltype(f26), decltype(f27), decltype(f28), decltype(f29),
+                            decltype(f30), decltype(f31), decltype(f32), decltype(f33), decltype(f34), decltype(f35),
+                            decltype(f36), decltype(f37), decltype(f38), decltype(f39), decltype(f40), decltype(f41),
+                            decltype(f42), decltype(f43), decltype(f44), decltype(f45), decltype(f46), decltype(f47),
+                            decltype(f48), decltype(f49), decltype(f50), decltype(f51), decltype(f52), decltype(f53),
+                            decltype(f54), decltype(f55), decltype(f56), decltype(f57), decltype(f58), decltype(f59),
+                            decltype(f60), decltype(f61)> &&
+           requires { &f0; &f1; &f2; &f3; &f4; &f5; &f6; &f7; &f8; &f9; &f10; &f11; &f12; &f13; &f14; &f15; &f16; &f17;
+                      &f18; &f19; &f20; &f21; &f22; &f23; &f24; &f25; &f26; &f27; &f28; &f29; &f30; &f31; &f32; &f33;
+                      &f34; &f35; &f36; &f37; &f38; &f39; &f40; &f41; &f42; &f43; &f44; &f45; &f46; &f47; &f48; &f49;
+                      &f50; &f51; &f52; &f53; &f54; &f55; &f56; &f57; &f58; &f59; &f60; &f61; };
+  } else if constexpr (N == 63) {
+    auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23,
+           f24, f25, f26, f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44, f45,
+           f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56, f57, f58, f59, f60, f61, f62] = kFakeObject<T>.value;
+    return !kHasReference<decltype(f0), decltype(f1), decltype(f2), decltype(f3), decltype(f4), decltype(f5),
+                            decltype(f6), decltype(f7), decltype(f8), decltype(f9), decltype(f10), decltype(f11),
+                            decltype(f12), decltype(f13), decltype(f14), decltype(f15), decltype(f16), decltype(f17),
+                            decltype(f18), decltype(f19), decltype(f20), decltype(f21), decltype(f22), decltype(f23),
+                            decltype(f24), decltype(f25), decltype(f26), decltype(f27), decltype(f28), decltype(f29),
+                            decltype(f30), decltype(f31), decltype(f32), decltype(f33), decltype(f34), decltype(f35),
+                            decltype(f36), decltype(f37), decltype(f38), decltype(f39), decltype(f40), decltype(f41),
+                            decltype(f42), decltype(f43), decltype(f44), decltype(f45), decltype(f46), decltype(f47),
+                            decltype(f48), decltype(f49), decltype(f50), decltype(f51), decltype(f52), decltype(f53),
+                            decltype(f54), decltype(f55), decltype(f56), decltype(f57), decltype(f58), decltype(f59),
+                            decltype(f60), decltype(f61), decltype(f62)> &&
+           requires { &f0; &f1; &f2; &f3; &f4; &f5; &f6; &f7; &f8; &f9; &f10; &f11; &f12; &f13; &f14; &f15; &f16; &f17;
+                      &f18; &f19; &f20; &f21; &f22; &f23; &f24; &f25; &f26; &f27; &f28; &f29; &f30; &f31; &f32; &f33;
+                      &f34; &f35; &f36; &f37; &f38; &f39; &f40; &f41; &f42; &f43; &f44; &f45; &f46; &f47; &f48; &f49;
+                      &f50; &f51; &f52; &f53; &f54; &f55; &f56; &f57; &f58; &f59; &f60; &f61; &f62; };
+  } else if constexpr (N == 64) {
+    auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16, f17, f18, f19, f20, f21, f22, f23,
+           f24, f25, f26, f27, f28, f29, f30, f31, f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44, f45,
+           f46, f47, f48, f49, f50, f51, f52, f53, f54, f55, f56, f57, f58, f59, f60, f61, f62,
+           f63] = kFakeObject<T>.value;
+    return !kHasReference<decltype(f0), decltype(f1), decltype(f2), decltype(f3), decltype(f4), decltype(f5),
+                            decltype(f6), decltype(f7), decltype(f8), decltype(f9), decltype(f10), decltype(f11),
+                            decltype(f12), decltype(f13), decltype(f14), decltype(f15), decltype(f16), decltype(f17),
+                            decltype(f18), decltype(f19), decltype(f20), decltype(f21), decltype(f22), decltype(f23),
+                            decltype(f24), decltype(f25), decltype(f26), decltype(f27), decltype(f28), decltype(f29),
+                            decltype(f30), decltype(f31), decltype(f32), decltype(f33), decltype(f34), decltype(f35),
+                            decltype(f36), decltype(f37), decltype(f38), decltype(f39), decltype(f40), decltype(f41),
+                            decltype(f42), decltype(f43), decltype(f44), decltype(f45), decltype(f46), decltype(f47),
+                            decltype(f48), decltype(f49), decltype(f50), decltype(f51), decltype(f52), decltype(f53),
+                            decltype(f54), decltype(f55), decltype(f56), decltype(f57), decltype(f58), decltype(f59),
+                            decltype(f60), decltype(f61), decltype(f62), decltype(f63)> &&
+           requires { &f0; &f1; &f2; &f3; &f4; &f5; &f6; &f7; &f8; &f9; &f10; &f11; &f12; &f13; &f14; &f15; &f16; &f17;
+                      &f18; &f19; &f20; &f21; &f22; &f23; &f24; &f25; &f26; &f27; &f28; &f29; &f30; &f31; &f32; &f33;
+                      &f34; &f35; &f36; &f37; &f38; &f39; &f40; &f41; &f42; &f43; &f44; &f45; &f46; &f47; &f48; &f49;
+                      &f50; &f51; &f52; &f53; &f54; &f55; &f56; &f57; &f58; &f59; &f60; &f61; &f62; &f63; };
+  } else {
+    return false;
+  }
+}
+
+// Every check after the field count relies on the previous ones, and the conjunction stops at the first that fails
+template <typename T>
+concept AggregateReflectable = std::is_class_v<T> && std::is_aggregate_v<T> && !std::is_polymorphic_v<T> &&
+                               !kHasAggregateBase<T> && kAggregateFieldCount<T> > 0 &&
+                               kAggregateFieldCount<T> <= kMaxAggregateFields && !HasArrayField<T>() &&
+                               !kHasUncountedField<T> && HasPlainFields<kAggregateFieldCount<T>, T>();
+
+template <typename T>
+struct FieldPointer {
+  const T* pointer;
+};
+
+template <typename T, std::size_t I>
+[[nodiscard]] consteval auto AggregateFieldPointer() noexcept {
+  const auto& field = std::get<I>(TieFields<kAggregateFieldCount<T>>(kFakeObject<T>.value));
+  return FieldPointer<std::remove_cvref_t<decltype(field)>>{&field};
+}
+
+[[nodiscard]] constexpr bool IsIdentifierChar(char c) noexcept {
+  return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_';
+}
+
+template <auto Pointer>
+[[nodiscard]] constexpr std::string_view RawFieldName() noexcept {
+#if defined(__clang__)
+  // Format: ... [Pointer = FieldPointer<TYPE>{&kFakeObject<T>.value.NAME}]
+  constexpr std::string_view function = CTTI_PRETTY_FUNCTION;
+  constexpr std::string_view suffix = "}]";
+#elif defined(__GNUC__) && !defined(__clang__)
+  // Format: ... [with auto Pointer = FieldPointer<TYPE>{(& kFakeObject<T>.FakeObject<T>::value.T::NAME)}; ...]
+  constexpr std::string_view function = CTTI_PRETTY_FUNCTION;
+  constexpr std::string_view suffix = ")}";
+#elif defined(_MSC_VER)
+  // Format: ... RawFieldName<FieldPointer<TYPE>{&kFakeObject<T>->value.NAME}>(void)
+  constexpr std::string_view function = CTTI_PRETTY_FUNCTION;
+  constexpr std::string_view suffix = "}>(void)";
+#endif
+
+  constexpr std::size_t end = function.find(suffix, function.find("Pointer"));
+  static_assert(end != std::string_view::npos, "Failed to extract field name from pretty function");
+
+  std::size_t start = end;
+  while (start > 0 && IsIdentifierChar(function[start - 1])) {
+    --start;
+  }
+  return function.substr(start, end - start);
+}
+
+template <typename T, std::size_t I>
+constexpr auto kAggregateFieldName = []() consteval {
+  constexpr std::string_view name = RawFieldName<AggregateFieldPointer<T, I>()>();
+  CompileTimeString<name.size() + 1> result;
+  std::copy_n(name.data(), name.size(), result.data_.begin());
+  return result;
+}();
+
+template <typename T, typename Indices>
+struct AggregateReflection;
+
+template <typename T, std::size_t... Is>
+struct AggregateReflection<T, std::index_sequence<Is...>> {
+  using Type = TypeReflection<T, SymbolDefinition<kAggregateFieldName<T, Is>, AggregateField<T, Is>{}>...>;
+};
+
+template <AggregateReflectable T>
+using AggregateReflectionType =
+    typename AggregateReflection<T, std::make_index_sequence<kAggregateFieldCount<T>>>::Type;
+
+}  // namespace ctti::detail
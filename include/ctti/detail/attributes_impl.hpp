@@ -75,6 +75,20 @@ template <typename Attr, typename Tag>
   return false;
 }
 
+template <typename Attr>
+concept KeyValueAttributeType = requires {
+  { Attr::key } -> std::convertible_to<std::string_view>;
+  Attr::value;
+};
+
+template <typename Attr, CompileTimeString Key>
+[[nodiscard]] constexpr bool AttributeHasKey() noexcept {
+  if constexpr (KeyValueAttributeType<Attr>) {
+    return Attr::key == Key.View();
+  }
+  return false;
+}
+
 template <typename... Attributes>
   requires(AttributeType<Attributes> && ...)
 struct AttributeList {
@@ -106,6 +120,23 @@ struct AttributeList {
     return (... || (requires { Attributes::name; } && Attributes::name == Name.View()));
   }
 
+  template <CompileTimeString Key>
+  [[nodiscard]] static constexpr bool HasKey() noexcept {
+    return (... || AttributeHasKey<Attributes, Key>());
+  }
+
+  // The value of the first key/value attribute with the key
+  template <CompileTimeString Key>
+    requires(HasKey<Key>())
+  [[nodiscard]] static constexpr auto GetKeyValue() noexcept {
+    constexpr std::size_t kIndex = [] {
+      std::size_t index = 0;
+      (void)(... || (AttributeHasKey<Attributes, Key>() || (++index, false)));
+      return index;
+    }();
+    return At<kIndex>::value;
+  }
+
   template <typename F>
     requires(std::invocable<const F&, Identity<Attributes>> && ...)
   static constexpr void ForEach(const F& func) noexcept((std::is_nothrow_invocable_v<const F&, Identity<Attributes>> &&
@@ -139,6 +170,17 @@ private:
   }
 };
 
+template <typename List>
+struct AttributeListOf;
+
+template <typename... Attributes>
+struct AttributeListOf<TypeList<Attributes...>> {
+  using type = AttributeList<Attributes...>;
+};
+
+template <typename List>
+using AttributeListOfType = TypeOf<AttributeListOf<List>>;
+
 struct ReadOnlyTag {};
 struct WriteOnlyTag {};
 struct DeprecatedTag {};
@@ -0,0 +1,486 @@
+#pragma once
+
+#include <ctti/detail/flatten_impl.hpp>
+#include <ctti/detail/meta.hpp>
+#include <ctti/enum_utils.hpp>
+#include <ctti/reflection.hpp>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+namespace ctti::detail {
+
+// Every column starts with one of these, so that a column can fall back to another encoding. 2 was a varint of the
+// XOR, which is no longer written or read.
+enum class ColumnEncoding : std::uint8_t { kDeltaVarint = 0, kPackedIndex = 1, kXorBits = 3, kDecimalDelta = 4 };
+
+constexpr std::size_t kMaxVarintSize = 10;
+
+[[nodiscard]] constexpr std::uint64_t ZigZagEncode(std::uint64_t value) noexcept {
+  return (value << 1) ^ (0 - (value >> 63));
+}
+
+[[nodiscard]] constexpr std::uint64_t ZigZagDecode(std::uint64_t value) noexcept {
+  return (value >> 1) ^ (0 - (value & 1));
+}
+
+[[nodiscard]] inline std::byte* WriteVarint(std::byte* out, std::uint64_t value) noexcept {
+  while (value >= 0x80) {
+    *out++ = static_cast<std::byte>(value | 0x80);
+    value >>= 7;
+  }
+  *out++ = static_cast<std::byte>(value);
+  return out;
+}
+
+[[nodiscard]] inline const std::byte* ReadVarint(const std::byte* in, const std::byte* end,
+                                                 std::uint64_t& value) noexcept {
+  value = 0;
+  for (unsigned shift = 0; in != end && shift < 64; shift += 7) {
+    const auto byte = static_cast<std::uint64_t>(*in++);
+    value |= (byte & 0x7F) << shift;
+    if (byte < 0x80) {
+      return in;
+    }
+  }
+  return nullptr;
+}
+
+// Integers are widened through their own signedness, so that narrowing the decoded sum gives back the value
+template <typename Value>
+[[nodiscard]] constexpr std::uint64_t IntegerBits(Value value) noexcept {
+  if constexpr (std::is_enum_v<Value>) {
+    return IntegerBits(static_cast<std::underlying_type_t<Value>>(value));
+  } else if constexpr (std::is_signed_v<Value>) {
+    return static_cast<std::uint64_t>(static_cast<std::int64_t>(value));
+  } else {
+    return static_cast<std::uint64_t>(value);
+  }
+}
+
+template <typename Value>
+[[nodiscard]] constexpr Value FromIntegerBits(std::uint64_t bits) noexcept {
+  if constexpr (std::is_enum_v<Value>) {
+    return static_cast<Value>(FromIntegerBits<std::underlying_type_t<Value>>(bits));
+  } else if constexpr (std::same_as<Value, bool>) {
+    return bits != 0;
+  } else {
+    return static_cast<Value>(bits);
+  }
+}
+
+// Appends bit fields LSB first, eight bytes at a time
+class BitWriter {
+public:
+  explicit BitWriter(std::byte* out) noexcept : out_(out) {}
+
+  // value must fit in width bits, and width must be at most 64
+  void Write(std::uint64_t value, unsigned width) noexcept {
+    buffer_ |= value << buffered_;
+    const unsigned total = buffered_ + width;
+    if (total < 64) {
+      buffered_ = total;
+      return;
+    }
+    for (unsigned shift = 0; shift < 64; shift += 8) {
+      *out_++ = static_cast<std::byte>(buffer_ >> shift);
+    }
+    buffer_ = buffered_ == 0 ? 0 : value >> (64 - buffered_);
+    buffered_ = total - 64;
+  }
+
+  [[nodiscard]] std::byte* Finish() noexcept {
+    for (unsigned shift = 0; shift < buffered_; shift += 8) {
+      *out_++ = static_cast<std::byte>(buffer_ >> shift);
+    }
+    return out_;
+  }
+
+private:
+  std::byte* out_;
+  std::uint64_t buffer_ = 0;
+  unsigned buffered_ = 0;
+};
+
+class BitReader {
+public:
+  explicit BitReader(std::span<const std::byte> bytes) noexcept : bytes_(bytes) {}
+
+  [[nodiscard]] bool Read(unsigned width, std::uint64_t& value) noexcept {
+    value = 0;
+    for (unsigned done = 0; done < width;) {
+      if (position_ / 8 >= bytes_.size()) {
+        return false;
+      }
+      const unsigned offset = static_cast<unsigned>(position_ % 8);
+      const unsigned take = std::min(8 - offset, width - done);
+      const auto bits = static_cast<std::uint64_t>(bytes_[position_ / 8]) >> offset;
+      value |= (bits & ((std::uint64_t{1} << take) - 1)) << done;
+      done += take;
+      position_ += take;
+    }
+    return true;
+  }
+
+  // True if every byte was consumed, allowing only zero padding in the last one
+  [[nodiscard]] bool AtEnd() const noexcept {
+    return (position_ + 7) / 8 == bytes_.size() &&
+           (position_ % 8 == 0 || (static_cast<unsigned>(bytes_.back()) >> (position_ % 8)) == 0);
+  }
+
+private:
+  std::span<const std::byte> bytes_;
+  std::size_t position_ = 0;
+};
+
+template <typename Value>
+using FloatBitsType = std::conditional_t<sizeof(Value) == 4, std::uint32_t, std::uint64_t>;
+
+template <typename Value>
+constexpr bool kXorEncoded = std::is_floating_point_v<Value> && (sizeof(Value) == 4 || sizeof(Value) == 8);
+
+// Gorilla-style XOR stream. Each value is XORed with the previous one and written as
+//   0                                                  if the XOR is zero
+//   1 0 <meaningful bits>                              if they fit in the previous window of meaningful bits
+//   1 1 <leading zeros> <meaningful length - 1> <bits> otherwise
+// where the window excludes the leading and trailing zero bits of the XOR. Neighbouring floats share their sign,
+// exponent and high mantissa bits, and short decimals end in zero bits, so most values take a few bits.
+template <typename Bits>
+class XorBitsWriter {
+public:
+  static constexpr unsigned kBits = sizeof(Bits) * 8;
+  static constexpr unsigned kCountWidth = std::bit_width(kBits - 1);
+
+  explicit XorBitsWriter(std::byte* out) noexcept : writer_(out) {}
+
+  void Write(Bits bits) noexcept {
+    const Bits xored = bits ^ previous_;
+    previous_ = bits;
+    if (xored == 0) {
+      writer_.Write(0, 1);
+      return;
+    }
+    const auto leading = static_cast<unsigned>(std::countl_zero(xored));
+    const auto trailing = static_cast<unsigned>(std::countr_zero(xored));
+    if (leading >= window_leading_ && kBits - trailing <= window_leading_ + window_length_) {
+      writer_.Write(0b01, 2);
+      writer_.Write(static_cast<std::uint64_t>(xored) >> (kBits - window_leading_ - window_length_), window_length_);
+      return;
+    }
+    window_leading_ = leading;
+    window_length_ = kBits - leading - trailing;
+    writer_.Write(0b11, 2);
+    writer_.Write(leading, kCountWidth);
+    writer_.Write(window_length_ - 1, kCountWidth);
+    writer_.Write(static_cast<std::uint64_t>(xored) >> trailing, window_length_);
+  }
+
+  [[nodiscard]] std::byte* Finish() noexcept { return writer_.Finish(); }
+
+private:
+  BitWriter writer_;
+  Bits previous_ = 0;
+  unsigned window_leading_ = kBits;
+  unsigned window_length_ = 0;
+};
+
+// Decodes the XOR stream written by XorBitsWriter into the raw bits of every value
+template <typename Bits>
+[[nodiscard]] bool ReadXorBitsColumn(std::span<const std::byte> column, std::span<std::uint64_t> values) noexcept {
+  constexpr unsigned kBits = XorBitsWriter<Bits>::kBits;
+  constexpr unsigned kCountWidth = XorBitsWriter<Bits>::kCountWidth;
+  BitReader reader(column);
+  std::uint64_t previous = 0;
+  unsigned window_leading = kBits;
+  unsigned window_length = 0;
+  for (std::uint64_t& value : values) {
+    std::uint64_t control = 0;
+    if (!reader.Read(1, control)) {
+      return false;
+    }
+    if (control != 0) {
+      if (!reader.Read(1, control)) {
+        return false;
+      }
+      if (control != 0) {
+        std::uint64_t leading = 0;
+        std::uint64_t length = 0;
+        if (!reader.Read(kCountWidth, leading) || !reader.Read(kCountWidth, length) || leading + length + 1 > kBits) {
+          return false;
+        }
+        window_leading = static_cast<unsigned>(leading);
+        window_length = static_cast<unsigned>(length) + 1;
+      } else if (window_length == 0) {
+        return false;
+      }
+      std::uint64_t meaningful = 0;
+      if (!reader.Read(window_length, meaningful)) {
+        return false;
+      }
+      previous ^= meaningful << (kBits - window_leading - window_length);
+    }
+    value = previous;
+  }
+  return reader.AtEnd();
+}
+
+template <typename T>
+concept ColumnLeaf = std::is_integral_v<T> || std::is_enum_v<T> || kXorEncoded<T>;
+
+// At least one bit, so that a column always takes one byte per eight values or more
+template <typename Value>
+[[nodiscard]] constexpr unsigned PackedIndexWidth() noexcept {
+  return std::max(static_cast<unsigned>(std::bit_width(enum_count<Value>() - 1)), 1U);
+}
+
+// Decodes a varint column into raw values first, so that the arithmetic runs as separate tight loops
+[[nodiscard]] inline bool ReadVarintColumn(std::span<const std::byte> column,
+                                           std::span<std::uint64_t> values) noexcept {
+  const std::byte* in = column.data();
+  const std::byte* end = column.data() + column.size();
+  for (std::uint64_t& value : values) {
+    in = ReadVarint(in, end, value);
+    if (in == nullptr) {
+      return false;
+    }
+  }
+  return in == end;
+}
+
+// Undoes the zigzag and the differences in separate passes, leaving the raw bits of every value
+[[nodiscard]] inline bool ReadDeltaVarintColumn(std::span<const std::byte> column,
+                                                std::span<std::uint64_t> values) noexcept {
+  if (!ReadVarintColumn(column, values)) {
+    return false;
+  }
+  for (std::uint64_t& value : values) {
+    value = ZigZagDecode(value);
+  }
+  std::uint64_t previous = 0;
+  for (std::uint64_t& value : values) {
+    value += previous;
+    previous = value;
+  }
+  return true;
+}
+
+// Decimal columns store round(value * 10^digits) and divide it back. Up to 2^53 the integers and their conversions
+// are exact, so the encoder only has to check that the division gives back the same bits.
+constexpr std::size_t kMaxDecimalDigits = 10;
+constexpr std::array<double, kMaxDecimalDigits + 1> kPowersOfTen = {1e0, 1e1, 1e2, 1e3, 1e4, 1e5,
+                                                                     1e6, 1e7, 1e8, 1e9, 1e10};
+constexpr double kMaxExactInteger = 9007199254740992.0;
+
+template <typename Value>
+[[nodiscard]] Value FromDecimal(std::int64_t scaled, std::size_t digits) noexcept {
+  return static_cast<Value>(static_cast<double>(scaled) / kPowersOfTen[digits]);
+}
+
+template <typename Value>
+[[nodiscard]] bool ToDecimal(Value value, std::size_t digits, std::int64_t& scaled) noexcept {
+  const double product = static_cast<double>(value) * kPowersOfTen[digits];
+  if (!(std::abs(product) <= kMaxExactInteger)) {
+    return false;
+  }
+  scaled = std::llround(product);
+  return std::bit_cast<FloatBitsType<Value>>(FromDecimal<Value>(scaled, digits)) ==
+         std::bit_cast<FloatBitsType<Value>>(value);
+}
+
+template <typename T, typename Path>
+struct ColumnCodec {
+  using ValueType = std::remove_cv_t<PathValueType<T, Path>>;
+
+  static void Encode(std::span<const T> objects, std::vector<std::byte>& out) {
+    out.resize(1 + objects.size() * kMaxVarintSize);
+    std::byte* position = out.data() + 1;
+    if constexpr (kXorEncoded<ValueType>) {
+      out[0] = static_cast<std::byte>(ColumnEncoding::kXorBits);
+      XorBitsWriter<FloatBitsType<ValueType>> writer(position);
+      for (const T& object : objects) {
+        writer.Write(std::bit_cast<FloatBitsType<ValueType>>(PathAccess<Path>::Get(object)));
+      }
+      out.resize(static_cast<std::size_t>(writer.Finish() - out.data()));
+      EncodeDecimal(objects, out);
+      return;
+    } else {
+      if constexpr (registered_enum<ValueType>) {
+        if (EncodePackedIndex(objects, out)) {
+          return;
+        }
+      }
+      out[0] = static_cast<std::byte>(ColumnEncoding::kDeltaVarint);
+      std::uint64_t previous = 0;
+      for (const T& object : objects) {
+        const std::uint64_t bits = IntegerBits(PathAccess<Path>::Get(object));
+        position = WriteVarint(position, ZigZagEncode(bits - previous));
+        previous = bits;
+      }
+    }
+    out.resize(static_cast<std::size_t>(position - out.data()));
+  }
+
+  [[nodiscard]] static bool Decode(std::span<const std::byte> column, std::span<T> objects,
+                                   std::vector<std::uint64_t>& values) {
+    if (column.empty()) {
+      return false;
+    }
+    const auto encoding = static_cast<ColumnEncoding>(column[0]);
+    column = column.subspan(1);
+    values.resize(objects.size());
+
+    if constexpr (kXorEncoded<ValueType>) {
+      if (encoding == ColumnEncoding::kDecimalDelta) {
+        return DecodeDecimal(column, objects, values);
+      }
+      if (encoding != ColumnEncoding::kXorBits || !ReadXorBitsColumn<FloatBitsType<ValueType>>(column, values)) {
+        return false;
+      }
+      for (std::size_t i = 0; i < objects.size(); ++i) {
+        PathAccess<Path>::Get(objects[i]) =
+            std::bit_cast<ValueType>(static_cast<FloatBitsType<ValueType>>(values[i]));
+      }
+      return true;
+    } else {
+      if constexpr (registered_enum<ValueType>) {
+        if (encoding == ColumnEncoding::kPackedIndex) {
+          return DecodePackedIndex(column, objects);
+        }
+      }
+      if (encoding != ColumnEncoding::kDeltaVarint || !ReadDeltaVarintColumn(column, values)) {
+        return false;
+      }
+      for (std::size_t i = 0; i < objects.size(); ++i) {
+        PathAccess<Path>::Get(objects[i]) = FromIntegerBits<ValueType>(values[i]);
+      }
+      return true;
+    }
+  }
+
+private:
+  // Replaces the XOR encoding in out when every value is a short decimal, such as a price, and the delta varints of
+  // the scaled integers take fewer bytes. The digits are the largest any single value needs.
+  static void EncodeDecimal(std::span<const T> objects, std::vector<std::byte>& out) {
+    std::size_t digits = 0;
+    std::int64_t scaled = 0;
+    for (const T& object : objects) {
+      const ValueType value = PathAccess<Path>::Get(object);
+      while (!ToDecimal(value, digits, scaled)) {
+        if (++digits > kMaxDecimalDigits) {
+          return;
+        }
+      }
+    }
+
+    std::vector<std::byte> decimal(2 + objects.size() * kMaxVarintSize);
+    decimal[0] = static_cast<std::byte>(ColumnEncoding::kDecimalDelta);
+    decimal[1] = static_cast<std::byte>(digits);
+    std::byte* position = decimal.data() + 2;
+    std::uint64_t previous = 0;
+    for (const T& object : objects) {
+      // A value that needs fewer digits may still fail at more of them
+      if (!ToDecimal(PathAccess<Path>::Get(object), digits, scaled)) {
+        return;
+      }
+      const auto bits = static_cast<std::uint64_t>(scaled);
+      position = WriteVarint(position, ZigZagEncode(bits - previous));
+      previous = bits;
+    }
+    const auto size = static_cast<std::size_t>(position - decimal.data());
+    if (size < out.size()) {
+      decimal.resize(size);
+      out.swap(decimal);
+    }
+  }
+
+  [[nodiscard]] static bool DecodeDecimal(std::span<const std::byte> column, std::span<T> objects,
+                                          std::span<std::uint64_t> values) {
+    if (column.empty() || static_cast<std::size_t>(column[0]) > kMaxDecimalDigits ||
+        !ReadDeltaVarintColumn(column.subspan(1), values)) {
+      return false;
+    }
+    const auto digits = static_cast<std::size_t>(column[0]);
+    for (std::size_t i = 0; i < objects.size(); ++i) {
+      PathAccess<Path>::Get(objects[i]) = FromDecimal<ValueType>(static_cast<std::int64_t>(values[i]), digits);
+    }
+    return true;
+  }
+
+  // Packs the index of every value in the registered enum list, LSB first. Fails if a value is not registered.
+  [[nodiscard]] static bool EncodePackedIndex(std::span<const T> objects, std::vector<std::byte>& out) {
+    constexpr unsigned kWidth = PackedIndexWidth<ValueType>();
+    out[0] = static_cast<std::byte>(ColumnEncoding::kPackedIndex);
+    std::byte* position = out.data() + 1;
+    std::uint64_t buffer = 0;
+    unsigned buffered = 0;
+    for (const T& object : objects) {
+      const auto index = enum_index(PathAccess<Path>::Get(object));
+      if (!index) {
+        return false;
+      }
+      buffer |= static_cast<std::uint64_t>(*index) << buffered;
+      buffered += kWidth;
+      for (; buffered >= 8; buffered -= 8, buffer >>= 8) {
+        *position++ = static_cast<std::byte>(buffer);
+      }
+    }
+    if (buffered != 0) {
+      *position++ = static_cast<std::byte>(buffer);
+    }
+    out.resize(static_cast<std::size_t>(position - out.data()));
+    return true;
+  }
+
+  [[nodiscard]] static bool DecodePackedIndex(std::span<const std::byte> column, std::span<T> objects) {
+    constexpr unsigned kWidth = PackedIndexWidth<ValueType>();
+    constexpr std::uint64_t kMask = (std::uint64_t{1} << kWidth) - 1;
+    if (column.size() != (objects.size() * kWidth + 7) / 8) {
+      return false;
+    }
+    const auto& entries = enum_entries<ValueType>();
+    std::size_t next_byte = 0;
+    std::uint64_t buffer = 0;
+    unsigned buffered = 0;
+    for (T& object : objects) {
+      for (; buffered < kWidth; buffered += 8) {
+        buffer |= static_cast<std::uint64_t>(column[next_byte++]) << buffered;
+      }
+      const auto index = static_cast<std::size_t>(buffer & kMask);
+      if (index >= entries.size()) {
+        return false;
+      }
+      PathAccess<Path>::Get(object) = entries[index];
+      buffer >>= kWidth;
+      buffered -= kWidth;
+    }
+    return true;
+  }
+};
+
+template <typename T, typename PathList>
+struct ColumnCodecs;
+
+template <typename T, typename... Paths>
+struct ColumnCodecs<T, TypeList<Paths...>> {
+  static constexpr std::size_t kCount = sizeof...(Paths);
+  static constexpr bool kEncodable = (ColumnLeaf<std::remove_cv_t<PathValueType<T, Paths>>> && ...);
+
+  static constexpr std::array<void (*)(std::span<const T>, std::vector<std::byte>&), kCount> kEncoders = {
+      &ColumnCodec<T, Paths>::Encode...};
+
+  static constexpr std::array<bool (*)(std::span<const std::byte>, std::span<T>, std::vector<std::uint64_t>&), kCount>
+      kDecoders = {&ColumnCodec<T, Paths>::Decode...};
+};
+
+template <reflectable T>
+using ColumnCodecsOf = ColumnCodecs<T, LeafPathsType<T>>;
+
+}  // namespace ctti::detail
@@ -0,0 +1,233 @@
+#pragma once
+
+#include <ctti/attributes.hpp>
+#include <ctti/detail/meta.hpp>
+#include <ctti/detail/reflection_impl.hpp>
+#include <ctti/reflection.hpp>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace ctti::detail {
+
+template <typename Attribute>
+struct IsCompareOrder : FalseType {};
+
+template <std::size_t Position>
+struct IsCompareOrder<compare_order<Position>> : TrueType {};
+
+template <typename AttributeList>
+struct CompareOrderOf;
+
+template <typename... Attributes>
+struct CompareOrderOf<TypeList<Attributes...>> {
+  static constexpr std::size_t kValue = [] {
+    std::size_t position = std::numeric_limits<std::size_t>::max();
+    ([&] {
+      if constexpr (IsCompareOrder<Attributes>::value) {
+        position = Attributes::position;
+      }
+    }(), ...);
+    return position;
+  }();
+};
+
+template <typename DefinitionList>
+struct CompareOrder;
+
+// Indices into the data member definitions, sorted by compare_order and then by reflection order
+template <typename... Definitions>
+struct CompareOrder<TypeList<Definitions...>> {
+  static constexpr std::array<std::size_t, sizeof...(Definitions)> kValue = [] {
+    constexpr std::array<std::size_t, sizeof...(Definitions)> keys = {
+        CompareOrderOf<typename Definitions::AttributesType>::kValue...};
+    std::array<std::size_t, sizeof...(Definitions)> order = {};
+    // Insertion sort keeps symbols with equal positions in reflection order
+    for (std::size_t i = 0; i < order.size(); ++i) {
+      std::size_t j = i;
+      for (; j > 0 && keys[order[j - 1]] > keys[i]; --j) {
+        order[j] = order[j - 1];
+      }
+      order[j] = i;
+    }
+    return order;
+  }();
+};
+
+// True when ordering T is ordering its bytes as unsigned chars in address order, so runs of T can be ordered with
+// memcmp
+template <typename T>
+[[nodiscard]] consteval bool IsBytewiseOrderable() noexcept {
+  if constexpr (std::is_array_v<T>) {
+    return IsBytewiseOrderable<std::remove_all_extents_t<T>>();
+  } else if constexpr (IsStdArray<T>::value) {
+    return std::has_unique_object_representations_v<T> && IsBytewiseOrderable<typename T::value_type>();
+  } else if constexpr (std::is_enum_v<T>) {
+    return IsBytewiseOrderable<std::underlying_type_t<T>>();
+  } else if constexpr (std::is_integral_v<T> && std::is_unsigned_v<T>) {
+    return std::has_unique_object_representations_v<T> && (sizeof(T) == 1 || std::endian::native == std::endian::big);
+  } else {
+    return false;
+  }
+}
+
+template <typename T>
+struct IsBytewiseComparableValue : BoolType<IsBytewiseComparable<T>()> {};
+
+template <typename T>
+struct IsBytewiseOrderableValue : BoolType<IsBytewiseOrderable<T>()> {};
+
+template <reflectable T>
+using CompareDefinitionsOf = DataMemberDefinitionsOf<T>;
+
+template <reflectable T, std::size_t I>
+using OrderedDefinitionAt =
+    typename CompareDefinitionsOf<T>::template At<CompareOrder<CompareDefinitionsOf<T>>::kValue[I]>;
+
+// Number of leading fields, in compare order, whose values satisfy Predicate
+template <reflectable T, template <typename> typename Predicate>
+constexpr std::size_t kBytewisePrefixLength = [] {
+  return []<std::size_t... Is>(std::index_sequence<Is...>) {
+    constexpr std::array<bool, sizeof...(Is)> matches = {
+        Predicate<DefinitionValueType<OrderedDefinitionAt<T, Is>>>::value...};
+    return static_cast<std::size_t>(std::find(matches.begin(), matches.end(), false) - matches.begin());
+  }(std::make_index_sequence<CompareDefinitionsOf<T>::kSize>{});
+}();
+
+// Compares the first Length fields in compare order with a single memcmp when they are laid out back to back.
+// The contiguity check only involves constant offsets, so it folds away after optimization.
+template <reflectable T, std::size_t Length>
+[[nodiscard]] int ComparePrefixBytes(const T& lhs, const T& rhs, bool& contiguous) noexcept {
+  return [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+    const std::byte* begin = DataMemberAddress<OrderedDefinitionAt<T, 0>>(lhs);
+    std::size_t size = 0;
+    contiguous = ((DataMemberAddress<OrderedDefinitionAt<T, Is>>(lhs) == begin + size &&
+                   (size += sizeof(DefinitionValueType<OrderedDefinitionAt<T, Is>>), true)) &&
+                  ...);
+    if (!contiguous) {
+      return 0;
+    }
+    return std::memcmp(begin, DataMemberAddress<OrderedDefinitionAt<T, 0>>(rhs), size);
+  }(std::make_index_sequence<Length>{});
+}
+
+template <typename T>
+[[nodiscard]] constexpr bool ValueEqual(const T& lhs, const T& rhs);
+
+template <typename T>
+[[nodiscard]] constexpr auto ValueCompare(const T& lhs, const T& rhs);
+
+template <reflectable T, std::size_t I>
+[[nodiscard]] constexpr bool FieldEqual(const T& lhs, const T& rhs) {
+  using symbol_type = typename OrderedDefinitionAt<T, I>::SymbolType;
+  return ValueEqual(symbol_type::GetValue(lhs), symbol_type::GetValue(rhs));
+}
+
+template <reflectable T, std::size_t I>
+[[nodiscard]] constexpr auto FieldCompare(const T& lhs, const T& rhs) {
+  using symbol_type = typename OrderedDefinitionAt<T, I>::SymbolType;
+  return ValueCompare(symbol_type::GetValue(lhs), symbol_type::GetValue(rhs));
+}
+
+template <reflectable T>
+[[nodiscard]] bool ReflectedEqual(const T& lhs, const T& rhs) {
+  if constexpr (kReflectsObjectRepresentation<T>) {
+    return std::memcmp(std::addressof(lhs), std::addressof(rhs), sizeof(T)) == 0;
+  } else {
+    constexpr std::size_t size = CompareDefinitionsOf<T>::kSize;
+    constexpr std::size_t prefix = kBytewisePrefixLength<T, IsBytewiseComparableValue>;
+
+    std::size_t first = 0;
+    if constexpr (prefix > 1) {
+      bool contiguous = false;
+      if (ComparePrefixBytes<T, prefix>(lhs, rhs, contiguous) != 0) {
+        return false;
+      }
+      first = contiguous ? prefix : 0;
+    }
+
+    return [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+      return ((Is < first || FieldEqual<T, Is>(lhs, rhs)) && ...);
+    }(std::make_index_sequence<size>{});
+  }
+}
+
+template <typename T>
+[[nodiscard]] consteval auto CompareCategoryOf() noexcept;
+
+template <reflectable T>
+using ReflectedCompareCategory = decltype(CompareCategoryOf<T>());
+
+template <reflectable T>
+[[nodiscard]] ReflectedCompareCategory<T> ReflectedCompare(const T& lhs, const T& rhs) {
+  constexpr std::size_t size = CompareDefinitionsOf<T>::kSize;
+  constexpr std::size_t prefix = kBytewisePrefixLength<T, IsBytewiseOrderableValue>;
+
+  std::size_t first = 0;
+  if constexpr (prefix > 1) {
+    bool contiguous = false;
+    const int result = ComparePrefixBytes<T, prefix>(lhs, rhs, contiguous);
+    if (result != 0) {
+      return result <=> 0;
+    }
+    first = contiguous ? prefix : 0;
+  }
+
+  ReflectedCompareCategory<T> result = std::strong_ordering::equal;
+  [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+    ((Is < first || (result = FieldCompare<T, Is>(lhs, rhs)) == 0) && ...);
+  }(std::make_index_sequence<size>{});
+  return result;
+}
+
+template <typename T>
+consteval auto CompareCategoryOf() noexcept {
+  if constexpr (reflectable<T>) {
+    return []<typename... Definitions>(TypeList<Definitions...>) {
+      return std::common_comparison_category_t<std::strong_ordering,
+                                               decltype(CompareCategoryOf<DefinitionValueType<Definitions>>())...>{
+          std::strong_ordering::equal};
+    }(CompareDefinitionsOf<T>{});
+  } else if constexpr (std::three_way_comparable<T>) {
+    return std::compare_three_way_result_t<T>{std::strong_ordering::equal};
+  } else {
+    return std::weak_ordering::equivalent;
+  }
+}
+
+template <typename T>
+constexpr bool ValueEqual(const T& lhs, const T& rhs) {
+  if constexpr (reflectable<T>) {
+    return ReflectedEqual(lhs, rhs);
+  } else {
+    return lhs == rhs;
+  }
+}
+
+template <typename T>
+constexpr auto ValueCompare(const T& lhs, const T& rhs) {
+  if constexpr (reflectable<T>) {
+    return ReflectedCompare(lhs, rhs);
+  } else if constexpr (std::three_way_comparable<T>) {
+    return lhs <=> rhs;
+  } else {
+    if (lhs < rhs) {
+      return std::weak_ordering::less;
+    }
+    if (rhs < lhs) {
+      return std::weak_ordering::greater;
+    }
+    return std::weak_ordering::equivalent;
+  }
+}
+
+}  // namespace ctti::detail
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <ctti/detail/meta.hpp>
+#include <ctti/detail/perfect_hash.hpp>
+#include <ctti/detail/reflection_impl.hpp>
+#include <ctti/enum_utils.hpp>
+#include <ctti/reflection.hpp>
+
+#include <array>
+#include <charconv>
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+
+namespace ctti::detail {
+
+template <typename T>
+struct IsCsvString : FalseType {};
+
+template <typename Traits, typename Allocator>
+struct IsCsvString<std::basic_string<char, Traits, Allocator>> : TrueType {};
+
+template <typename T>
+concept CsvField = std::is_arithmetic_v<T> || std::is_enum_v<T> || IsCsvString<T>::value;
+
+template <typename Number>
+[[nodiscard]] bool ParseNumber(std::string_view cell, Number& value) noexcept {
+  const char* end = cell.data() + cell.size();
+  // from_chars rejects the leading plus sign that spreadsheets sometimes write
+  const char* begin = !cell.empty() && cell.front() == '+' ? cell.data() + 1 : cell.data();
+  const auto [ptr, error] = std::from_chars(begin, end, value);
+  return error == std::errc{} && ptr == end;
+}
+
+// Empty cells leave the field unchanged
+template <CsvField Value>
+[[nodiscard]] bool ParseCell(std::string_view cell, Value& value) {
+  if (cell.empty()) {
+    return true;
+  }
+  if constexpr (IsCsvString<Value>::value) {
+    // Reuses the capacity the string already has
+    value.assign(cell);
+    return true;
+  } else if constexpr (std::same_as<Value, bool>) {
+    if (cell == "1" || cell == "true") {
+      value = true;
+    } else if (cell == "0" || cell == "false") {
+      value = false;
+    } else {
+      return false;
+    }
+    return true;
+  } else if constexpr (std::is_enum_v<Value>) {
+    if constexpr (registered_enum<Value>) {
+      if (const auto named = enum_cast<Value>(cell)) {
+        value = *named;
+        return true;
+      }
+    }
+    std::underlying_type_t<Value> underlying{};
+    if (!ParseNumber(cell, underlying)) {
+      return false;
+    }
+    value = static_cast<Value>(underlying);
+    return true;
+  } else {
+    return ParseNumber(cell, value);
+  }
+}
+
+template <typename T, typename DefinitionList>
+struct CsvFields;
+
+template <typename T, typename... Definitions>
+struct CsvFields<T, TypeList<Definitions...>> {
+  static constexpr std::size_t kCount = sizeof...(Definitions);
+  static constexpr bool kParsable = (CsvField<DefinitionValueType<Definitions>> && ...);
+  static constexpr std::array<std::string_view, kCount> kNames = {Definitions::kName...};
+  static constexpr PerfectHashIndex<kCount> kIndex{kNames};
+
+  // One parser per data member, indexed by the column mapping built from the header
+  static constexpr std::array<bool (*)(std::string_view, T&), kCount> kParsers = {
+      +[](std::string_view cell, T& object) { return ParseCell(cell, Definitions::SymbolType::GetValue(object)); }...};
+};
+
+template <reflectable T>
+using CsvFieldsOf = CsvFields<T, DataMemberDefinitionsOf<T>>;
+
+}  // namespace ctti::detail
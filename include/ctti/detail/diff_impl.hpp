@@ -0,0 +1,183 @@
+#pragma once
+
+#include <ctti/detail/compare_impl.hpp>
+#include <ctti/detail/meta.hpp>
+#include <ctti/detail/reflection_impl.hpp>
+#include <ctti/detail/serialize_impl.hpp>
+#include <ctti/reflection.hpp>
+
+#include <array>
+#include <bit>
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace ctti::detail {
+
+// Smallest unsigned integer with at least N bits, or a bitset for more than 64 bits
+template <std::size_t N>
+using FieldMaskType = std::conditional_t<
+    N <= 8, std::uint8_t,
+    std::conditional_t<N <= 16, std::uint16_t,
+                       std::conditional_t<N <= 32, std::uint32_t,
+                                          std::conditional_t<N <= 64, std::uint64_t, std::bitset<N>>>>>;
+
+template <typename Mask>
+[[nodiscard]] constexpr bool MaskTest(const Mask& mask, std::size_t index) noexcept {
+  if constexpr (std::is_integral_v<Mask>) {
+    return ((mask >> index) & Mask{1}) != 0;
+  } else {
+    return mask.test(index);
+  }
+}
+
+template <typename Mask>
+constexpr void MaskSet(Mask& mask, std::size_t index) noexcept {
+  if constexpr (std::is_integral_v<Mask>) {
+    mask = static_cast<Mask>(mask | static_cast<Mask>(Mask{1} << index));
+  } else {
+    mask.set(index);
+  }
+}
+
+template <typename Mask>
+[[nodiscard]] constexpr std::size_t MaskCount(const Mask& mask) noexcept {
+  if constexpr (std::is_integral_v<Mask>) {
+    return static_cast<std::size_t>(std::popcount(mask));
+  } else {
+    return mask.count();
+  }
+}
+
+template <typename DefinitionList>
+struct PatchValues;
+
+template <typename... Definitions>
+struct PatchValues<TypeList<Definitions...>> {
+  using Type = std::tuple<DefinitionValueType<Definitions>...>;
+};
+
+// The mask alone records which values are meaningful, the others keep whatever they last held
+template <reflectable T>
+using PatchValuesType = typename PatchValues<DataMemberDefinitionsOf<T>>::Type;
+
+// Grants the free functions operating on patches access to their internals
+struct PatchAccess {
+  template <typename Patch>
+  [[nodiscard]] static constexpr auto& Mask(Patch& changes) noexcept {
+    return changes.mask_;
+  }
+
+  template <typename Patch>
+  [[nodiscard]] static constexpr auto& Values(Patch& changes) noexcept {
+    return changes.values_;
+  }
+};
+
+template <typename Patch, reflectable T, typename Object>
+[[nodiscard]] constexpr Patch Diff(const T& before, Object&& after) {
+  Patch result;
+  [&]<typename... Definitions, std::size_t... Is>(TypeList<Definitions...>, std::index_sequence<Is...>) {
+    (
+        [&] {
+          auto& new_value = Definitions::SymbolType::GetValue(after);
+          if (!ValueEqual(Definitions::SymbolType::GetValue(before), new_value)) {
+            if constexpr (std::is_lvalue_reference_v<Object>) {
+              std::get<Is>(PatchAccess::Values(result)) = new_value;
+            } else {
+              std::get<Is>(PatchAccess::Values(result)) = std::move(new_value);
+            }
+            MaskSet(PatchAccess::Mask(result), Is);
+          }
+        }(),
+        ...);
+  }(DataMemberDefinitionsOf<T>{}, std::make_index_sequence<DataMemberDefinitionsOf<T>::kSize>{});
+  return result;
+}
+
+template <reflectable T, typename Patch>
+constexpr void ApplyPatch(T& object, Patch&& changes) {
+  auto& values = PatchAccess::Values(changes);
+  [&]<typename... Definitions, std::size_t... Is>(TypeList<Definitions...>, std::index_sequence<Is...>) {
+    (
+        [&] {
+          if (MaskTest(PatchAccess::Mask(changes), Is)) {
+            if constexpr (std::is_lvalue_reference_v<Patch>) {
+              Definitions::SymbolType::SetValue(object, std::get<Is>(values));
+            } else {
+              Definitions::SymbolType::SetValue(object, std::move(std::get<Is>(values)));
+            }
+          }
+        }(),
+        ...);
+  }(DataMemberDefinitionsOf<T>{}, std::make_index_sequence<DataMemberDefinitionsOf<T>::kSize>{});
+}
+
+// Integral masks are written as they are, bitsets as ceil(N / 8) bytes in bit order
+template <std::size_t N, typename Writer, typename Mask>
+void WriteMask(Writer& writer, const Mask& mask) {
+  if constexpr (std::is_integral_v<Mask>) {
+    writer.write_bytes(&mask, sizeof(Mask));
+  } else {
+    std::array<std::uint8_t, (N + 7) / 8> bytes = {};
+    for (std::size_t i = 0; i < N; ++i) {
+      bytes[i / 8] = static_cast<std::uint8_t>(bytes[i / 8] | (mask.test(i) ? 1U << (i % 8) : 0U));
+    }
+    writer.write_bytes(bytes.data(), bytes.size());
+  }
+}
+
+// Rejects masks with bits set past the last data member
+template <std::size_t N, typename Reader, typename Mask>
+[[nodiscard]] bool ReadMask(Reader& reader, Mask& mask) {
+  if constexpr (std::is_integral_v<Mask>) {
+    if (!reader.read_bytes(&mask, sizeof(Mask))) {
+      return false;
+    }
+    return N == sizeof(Mask) * 8 || (mask >> N) == 0;
+  } else {
+    std::array<std::uint8_t, (N + 7) / 8> bytes = {};
+    if (!reader.read_bytes(bytes.data(), bytes.size())) {
+      return false;
+    }
+    mask.reset();
+    for (std::size_t i = 0; i < N; ++i) {
+      mask.set(i, ((bytes[i / 8] >> (i % 8)) & 1U) != 0);
+    }
+    return N % 8 == 0 || (bytes.back() >> (N % 8)) == 0;
+  }
+}
+
+template <reflectable T, typename Writer, typename Patch>
+void WritePatch(Writer& writer, const Patch& changes) {
+  const auto& mask = PatchAccess::Mask(changes);
+  const auto& values = PatchAccess::Values(changes);
+  WriteMask<DataMemberDefinitionsOf<T>::kSize>(writer, mask);
+  [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+    (
+        [&] {
+          if (MaskTest(mask, Is)) {
+            WriteValue<SchemaVersion<T>::value>(writer, std::get<Is>(values));
+          }
+        }(),
+        ...);
+  }(std::make_index_sequence<DataMemberDefinitionsOf<T>::kSize>{});
+}
+
+template <reflectable T, typename Reader, typename Patch>
+[[nodiscard]] bool ReadPatch(Reader& reader, Patch& changes) {
+  auto& mask = PatchAccess::Mask(changes);
+  auto& values = PatchAccess::Values(changes);
+  if (!ReadMask<DataMemberDefinitionsOf<T>::kSize>(reader, mask)) {
+    return false;
+  }
+  return [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+    return ([&] { return !MaskTest(mask, Is) || ReadValue<SchemaVersion<T>::value>(reader, std::get<Is>(values)); }() &&
+            ...);
+  }(std::make_index_sequence<DataMemberDefinitionsOf<T>::kSize>{});
+}
+
+}  // namespace ctti::detail
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <ctti/execution.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace ctti::detail {
+
+// Fits comfortably in the L2 cache of current cores
+constexpr std::size_t kDefaultChunkBytes = std::size_t{256} * 1024;
+
+[[nodiscard]] inline std::size_t ChunkBytes(const exec_policy& policy) noexcept {
+  return policy.chunk_bytes != 0 ? policy.chunk_bytes : kDefaultChunkBytes;
+}
+
+// Number of items per chunk, so that a chunk holds about ChunkBytes(policy) bytes
+[[nodiscard]] inline std::size_t ChunkLength(const exec_policy& policy, std::size_t item_size) noexcept {
+  return std::max<std::size_t>(ChunkBytes(policy) / std::max<std::size_t>(item_size, 1), 1);
+}
+
+[[nodiscard]] inline std::size_t ThreadCount(const exec_policy& policy, std::size_t chunk_count) noexcept {
+  const std::size_t requested =
+      policy.thread_count != 0 ? policy.thread_count : std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+  return std::min(requested, chunk_count);
+}
+
+// Calls func(chunk) for every chunk in [0, chunk_count). Threads take the next chunk from a shared counter, so that
+// uneven chunks still balance. The first exception thrown by any chunk is rethrown once all threads have stopped.
+template <typename F>
+void ParallelFor(std::size_t chunk_count, const exec_policy& policy, const F& func) {
+  const std::size_t thread_count = ThreadCount(policy, chunk_count);
+  if (thread_count <= 1) {
+    for (std::size_t chunk = 0; chunk < chunk_count; ++chunk) {
+      func(chunk);
+    }
+    return;
+  }
+
+  std::atomic<std::size_t> next_chunk{0};
+  std::exception_ptr error;
+  std::mutex error_mutex;
+  auto worker = [&] {
+    try {
+      for (std::size_t chunk = next_chunk.fetch_add(1, std::memory_order_relaxed); chunk < chunk_count;
+           chunk = next_chunk.fetch_add(1, std::memory_order_relaxed)) {
+        func(chunk);
+      }
+    } catch (...) {
+      // Makes the other threads run out of chunks
+      next_chunk.store(chunk_count, std::memory_order_relaxed);
+      const std::lock_guard lock(error_mutex);
+      if (!error) {
+        error = std::current_exception();
+      }
+    }
+  };
+
+  {
+    std::vector<std::jthread> threads;
+    threads.reserve(thread_count - 1);
+    for (std::size_t i = 1; i < thread_count; ++i) {
+      threads.emplace_back(worker);
+    }
+    worker();
+  }
+  if (error) {
+    std::rethrow_exception(error);
+  }
+}
+
+}  // namespace ctti::detail
@@ -0,0 +1,126 @@
+#pragma once
+
+#include <ctti/detail/layout_info_impl.hpp>
+#include <ctti/detail/meta.hpp>
+#include <ctti/detail/perfect_hash.hpp>
+#include <ctti/detail/reflection_impl.hpp>
+#include <ctti/reflection.hpp>
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <memory>
+#include <string_view>
+#include <type_traits>
+
+namespace ctti::detail {
+
+template <typename T, typename Prefix>
+struct LeafPaths;
+
+// A data member whose type is itself reflectable is expanded into the leaves of that type
+template <typename Prefix, typename Definition, bool Nested = reflectable<DefinitionValueType<Definition>>>
+struct DefinitionLeafPaths {
+  using Type = TypeList<CatType<Prefix, TypeList<Definition>>>;
+};
+
+template <typename Prefix, typename Definition>
+struct DefinitionLeafPaths<Prefix, Definition, true> {
+  using Type = typename LeafPaths<DefinitionValueType<Definition>, CatType<Prefix, TypeList<Definition>>>::Type;
+};
+
+template <typename Prefix, typename DefinitionList>
+struct LeafPathsOf;
+
+template <typename Prefix, typename... Definitions>
+struct LeafPathsOf<Prefix, TypeList<Definitions...>> {
+  using Type = CatManyType<TypeList<>, typename DefinitionLeafPaths<Prefix, Definitions>::Type...>;
+};
+
+// Every path of data member definitions from T down to a data member that is not reflectable itself
+template <typename T, typename Prefix = TypeList<>>
+struct LeafPaths {
+  using Type = typename LeafPathsOf<Prefix, DataMemberDefinitionsOf<T>>::Type;
+};
+
+template <typename T>
+using LeafPathsType = typename LeafPaths<T>::Type;
+
+template <typename Path>
+struct PathName;
+
+// The names of the definitions along a path joined with dots, such as "pose.position.x"
+template <typename... Definitions>
+struct PathName<TypeList<Definitions...>> {
+  static constexpr auto kStorage = [] {
+    constexpr std::size_t size = (std::size_t{0} + ... + Definitions::kName.size()) + sizeof...(Definitions) - 1;
+    std::array<char, size + 1> storage = {};
+    std::size_t offset = 0;
+    (
+        [&] {
+          if (offset != 0) {
+            storage[offset++] = '.';
+          }
+          std::copy(Definitions::kName.begin(), Definitions::kName.end(), storage.begin() + offset);
+          offset += Definitions::kName.size();
+        }(),
+        ...);
+    return storage;
+  }();
+
+  static constexpr std::string_view kValue{kStorage.data(), kStorage.size() - 1};
+};
+
+template <typename Path>
+struct PathAccess;
+
+template <typename First, typename... Rest>
+struct PathAccess<TypeList<First, Rest...>> {
+  template <typename Object>
+  [[nodiscard]] static constexpr auto& Get(Object& object) noexcept {
+    auto& value = First::SymbolType::GetValue(object);
+    if constexpr (sizeof...(Rest) == 0) {
+      return value;
+    } else {
+      return PathAccess<TypeList<Rest...>>::Get(value);
+    }
+  }
+};
+
+template <typename T, typename Path>
+using PathValueType = std::remove_reference_t<decltype(PathAccess<Path>::Get(std::declval<T&>()))>;
+
+template <typename T, typename PathList>
+struct FlatLeaves;
+
+template <typename T, typename... Paths>
+struct FlatLeaves<T, TypeList<Paths...>> {
+  static constexpr std::size_t kCount = sizeof...(Paths);
+  static constexpr std::array<std::string_view, kCount> kNames = {PathName<Paths>::kValue...};
+  static constexpr PerfectHashIndex<kCount> kIndex{kNames};
+
+  template <typename Value>
+  static constexpr std::array<bool, kCount> kHolds = {std::same_as<std::remove_cv_t<PathValueType<T, Paths>>,
+                                                                   std::remove_cv_t<Value>>...};
+
+  // One accessor per leaf. Each one inlines the chain of member accesses down to the leaf.
+  static constexpr std::array<const void* (*)(const T&) noexcept, kCount> kAccessors = {
+      +[](const T& object) noexcept -> const void* { return std::addressof(PathAccess<Paths>::Get(object)); }...};
+
+  template <typename Object, typename F>
+  static constexpr std::array<void (*)(Object&, F&), kCount> kVisitors = {
+      +[](Object& object, F& func) { func(PathAccess<Paths>::Get(object)); }...};
+
+  // Byte offset of every leaf from the start of T, computed once from an unconstructed probe object
+  [[nodiscard]] static const std::array<std::size_t, kCount>& Offsets() noexcept {
+    static const std::array<std::size_t, kCount> offsets = {
+        SubobjectOffset<T>([](const T& object) -> const auto& { return PathAccess<Paths>::Get(object); })...};
+    return offsets;
+  }
+};
+
+template <reflectable T>
+using FlatLeavesOf = FlatLeaves<T, LeafPathsType<T>>;
+
+}  // namespace ctti::detail
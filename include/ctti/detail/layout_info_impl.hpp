@@ -0,0 +1,97 @@
+#pragma once
+
+#include <ctti/detail/meta.hpp>
+#include <ctti/detail/reflection_impl.hpp>
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <string_view>
+
+namespace ctti::detail {
+
+struct FieldShape {
+  std::string_view name;
+  std::size_t size = 0;
+  std::size_t alignment = 0;
+};
+
+[[nodiscard]] constexpr std::size_t AlignUp(std::size_t value, std::size_t alignment) noexcept {
+  return (value + alignment - 1) / alignment * alignment;
+}
+
+template <typename DefinitionList>
+struct FieldShapes;
+
+template <typename... Definitions>
+struct FieldShapes<TypeList<Definitions...>> {
+  static constexpr std::array<FieldShape, sizeof...(Definitions)> kValue = {
+      FieldShape{Definitions::kName, sizeof(DefinitionValueType<Definitions>),
+                 alignof(DefinitionValueType<Definitions>)}...};
+};
+
+// Orders fields by decreasing alignment, then decreasing size, keeping the original order between equal fields.
+// Every field then starts on an offset that is already a multiple of its alignment, so no padding is inserted
+// between fields.
+template <std::size_t N>
+[[nodiscard]] constexpr std::array<FieldShape, N> SortByAlignment(std::array<FieldShape, N> shapes) noexcept {
+  for (std::size_t i = 1; i < N; ++i) {
+    const FieldShape shape = shapes[i];
+    std::size_t j = i;
+    for (; j > 0 && (shapes[j - 1].alignment < shape.alignment ||
+                     (shapes[j - 1].alignment == shape.alignment && shapes[j - 1].size < shape.size));
+         --j) {
+      shapes[j] = shapes[j - 1];
+    }
+    shapes[j] = shape;
+  }
+  return shapes;
+}
+
+// Size of a struct laying out the fields in the given order, rounded up to the alignment of the struct
+template <std::size_t N>
+[[nodiscard]] constexpr std::size_t LayoutSize(const std::array<FieldShape, N>& shapes,
+                                               std::size_t alignment) noexcept {
+  std::size_t offset = 0;
+  for (const FieldShape& shape : shapes) {
+    offset = AlignUp(offset, shape.alignment) + shape.size;
+  }
+  return AlignUp(offset, alignment);
+}
+
+// Storage for T that is never constructed. Only member addresses are taken from it, the same way offsetof works for
+// standard-layout types.
+template <typename T>
+union LayoutProbe {
+  LayoutProbe() noexcept {}
+  ~LayoutProbe() noexcept {}
+
+  T object;
+};
+
+template <typename T>
+[[nodiscard]] const LayoutProbe<T>& ProbeOf() noexcept {
+  static const LayoutProbe<T> probe;
+  return probe;
+}
+
+// Offset of the subobject that access(object) refers to. Every offset computation goes through here, so that there is
+// a single probe per type.
+template <typename T, typename Access>
+[[nodiscard]] std::size_t SubobjectOffset(const Access& access) noexcept {
+  const LayoutProbe<T>& probe = ProbeOf<T>();
+  return static_cast<std::size_t>(reinterpret_cast<const std::byte*>(std::addressof(access(probe.object))) -
+                                  reinterpret_cast<const std::byte*>(std::addressof(probe.object)));
+}
+
+template <typename T, typename MemberPointer>
+[[nodiscard]] std::size_t MemberOffset(MemberPointer member) noexcept {
+  return SubobjectOffset<T>([member](const T& object) -> const auto& { return object.*member; });
+}
+
+template <DataMemberDefinition Definition, typename T>
+[[nodiscard]] std::size_t DataMemberOffset() noexcept {
+  return SubobjectOffset<T>([](const T& object) -> const auto& { return Definition::SymbolType::GetValue(object); });
+}
+
+}  // namespace ctti::detail
@@ -1,6 +1,17 @@
 #pragma once
 
+#include <ctti/detail/layout_info_impl.hpp>
+#include <ctti/detail/meta.hpp>
+#include <ctti/detail/reflection_impl.hpp>
+#include <ctti/reflection.hpp>
+
+#include <algorithm>
+#include <array>
 #include <concepts>
+#include <cstddef>
+#include <cstring>
+#include <span>
+#include <string_view>
 #include <type_traits>
 #include <utility>
 
@@ -9,11 +20,17 @@ namespace ctti::detail {
 struct DefaultSymbolMappingFunction {
   constexpr DefaultSymbolMappingFunction() noexcept = default;
 
+  // Moves the field when the source is an rvalue, and copies it otherwise
   template <typename Source, typename SourceSymbol, typename Sink, typename SinkSymbol>
-  void operator()(const Source& source, SourceSymbol /*src_symbol*/, Sink& sink,
-                  SinkSymbol /*sink_symbol*/) const noexcept {
-    if constexpr (SourceSymbol::template is_owner_of<Source>() && SinkSymbol::template is_owner_of<Sink>()) {
-      sink.*(SinkSymbol::template get_member<Sink>()) = source.*(SourceSymbol::template get_member<Source>());
+  void operator()(Source&& source, SourceSymbol /*src_symbol*/, Sink& sink, SinkSymbol /*sink_symbol*/) const noexcept {
+    using SourceType = std::remove_cvref_t<Source>;
+    // Goes through the symbols rather than member pointers, since aggregate fields have no member pointer
+    if constexpr (SourceSymbol::template is_owner_of<SourceType>() && SinkSymbol::template is_owner_of<Sink>()) {
+      if constexpr (std::is_lvalue_reference_v<Source>) {
+        SinkSymbol::set_value(sink, SourceSymbol::get_value(source));
+      } else {
+        SinkSymbol::set_value(sink, std::move(SourceSymbol::get_value(source)));
+      }
     }
   }
 };
@@ -31,6 +48,21 @@ void Map(const Source& source, Sink& sink) noexcept(
   Map<SourceSymbol, SinkSymbol>(source, sink, DefaultSymbolMappingFunction());
 }
 
+template <typename SourceSymbol, typename SinkSymbol, typename Source, typename Sink, typename Function>
+  requires(!std::is_lvalue_reference_v<Source> && std::invocable<const Function&, Source&&, SourceSymbol&&, Sink&,
+                                                                 SinkSymbol&&>)
+void Map(Source&& source, Sink& sink, const Function& function) noexcept(
+    std::is_nothrow_invocable_v<const Function&, Source&&, SourceSymbol, Sink&, SinkSymbol>) {
+  function(std::move(source), SourceSymbol(), sink, SinkSymbol());
+}
+
+template <typename SourceSymbol, typename SinkSymbol, typename Source, typename Sink>
+  requires(!std::is_lvalue_reference_v<Source>)
+void Map(Source&& source, Sink& sink) noexcept(
+    std::is_nothrow_invocable_v<DefaultSymbolMappingFunction, Source&&, SourceSymbol, Sink&, SinkSymbol>) {
+  Map<SourceSymbol, SinkSymbol>(std::move(source), sink, DefaultSymbolMappingFunction());
+}
+
 template <typename SourceSymbol, typename SinkSymbol, typename Function = DefaultSymbolMappingFunction>
 class SymbolMapping {
 public:
@@ -53,6 +85,14 @@ public:
     function_(source, SourceSymbol(), sink, SinkSymbol());
   }
 
+  template <typename Source, typename Sink>
+    requires(!std::is_lvalue_reference_v<Source> &&
+             std::invocable<const Function&, Source&&, SourceSymbol&&, Sink&, SinkSymbol&&>)
+  void operator()(Source&& source, Sink& sink) const
+      noexcept(std::is_nothrow_invocable_v<const Function&, Source&&, SourceSymbol, Sink&, SinkSymbol>) {
+    function_(std::move(source), SourceSymbol(), sink, SinkSymbol());
+  }
+
 private:
   Function function_;
 };
@@ -76,4 +116,253 @@ void Map(const Source& source, Sink& sink,
   (mappings(source, sink), ...);
 }
 
+// Every mapping receives the source as an rvalue, so each field must be moved by at most one of them
+template <typename Source, typename Sink, typename... Mappings>
+  requires(!std::is_lvalue_reference_v<Source> && (std::invocable<const Mappings&, Source&&, Sink&> && ...))
+void Map(Source&& source, Sink& sink,
+         const Mappings&... mappings) noexcept((std::is_nothrow_invocable_v<const Mappings&, Source&&, Sink&> && ...)) {
+  (mappings(std::move(source), sink), ...);
+}
+
+template <typename SourceDefinition, typename SinkDefinition, typename Sink>
+constexpr bool kDefinitionsMatch =
+    SourceDefinition::kName == SinkDefinition::kName &&
+    std::same_as<DefinitionValueType<SourceDefinition>, DefinitionValueType<SinkDefinition>> &&
+    std::is_assignable_v<decltype(SinkDefinition::SymbolType::GetValue(std::declval<Sink&>())),
+                         const DefinitionValueType<SourceDefinition>&>;
+
+// Index of the sink data member with the same name and value type, or the number of sink data members if none
+template <typename SourceDefinition, typename Sink, typename... SinkDefinitions>
+[[nodiscard]] consteval std::size_t MatchingSinkIndex(TypeList<SinkDefinitions...> /*definitions*/) noexcept {
+  std::size_t index = 0;
+  (void)(... || (kDefinitionsMatch<SourceDefinition, SinkDefinitions, Sink> || (++index, false)));
+  return index;
+}
+
+template <typename Source, typename Sink, typename SourceDefinitionList = DataMemberDefinitionsOf<Source>,
+          typename SinkDefinitionList = DataMemberDefinitionsOf<Sink>>
+struct AutoMapping;
+
+template <typename Source, typename Sink, typename... SourceDefinitions, typename... SinkDefinitions>
+struct AutoMapping<Source, Sink, TypeList<SourceDefinitions...>, TypeList<SinkDefinitions...>> {
+  static constexpr std::size_t kSinkCount = sizeof...(SinkDefinitions);
+
+  static constexpr std::array<std::size_t, sizeof...(SourceDefinitions)> kSinkIndices = {
+      MatchingSinkIndex<SourceDefinitions, Sink>(TypeList<SinkDefinitions...>{})...};
+
+  static constexpr std::size_t kMatchedCount = static_cast<std::size_t>(
+      std::count_if(kSinkIndices.begin(), kSinkIndices.end(), [](std::size_t index) { return index < kSinkCount; }));
+
+  static constexpr std::array<bool, kSinkCount> kSinkMatched = [] {
+    std::array<bool, kSinkCount> matched = {};
+    for (const std::size_t index : kSinkIndices) {
+      if (index < kSinkCount) {
+        matched[index] = true;
+      }
+    }
+    return matched;
+  }();
+
+  static constexpr std::array<std::string_view, kMatchedCount> kMatchedNames = [] {
+    constexpr std::array<std::string_view, sizeof...(SourceDefinitions)> kNames = {SourceDefinitions::kName...};
+    std::array<std::string_view, kMatchedCount> names = {};
+    std::size_t count = 0;
+    for (std::size_t i = 0; i < kNames.size(); ++i) {
+      if (kSinkIndices[i] < kSinkCount) {
+        names[count++] = kNames[i];
+      }
+    }
+    return names;
+  }();
+
+  static constexpr std::array<std::string_view, sizeof...(SourceDefinitions) - kMatchedCount> kUnmatchedSource = [] {
+    constexpr std::array<std::string_view, sizeof...(SourceDefinitions)> kNames = {SourceDefinitions::kName...};
+    std::array<std::string_view, sizeof...(SourceDefinitions) - kMatchedCount> names = {};
+    std::size_t count = 0;
+    for (std::size_t i = 0; i < kNames.size(); ++i) {
+      if (kSinkIndices[i] >= kSinkCount) {
+        names[count++] = kNames[i];
+      }
+    }
+    return names;
+  }();
+
+  static constexpr std::array<std::string_view, kSinkCount - kMatchedCount> kUnmatchedSink = [] {
+    constexpr std::array<std::string_view, kSinkCount> kNames = {SinkDefinitions::kName...};
+    std::array<std::string_view, kSinkCount - kMatchedCount> names = {};
+    std::size_t count = 0;
+    for (std::size_t i = 0; i < kNames.size(); ++i) {
+      if (!kSinkMatched[i]) {
+        names[count++] = kNames[i];
+      }
+    }
+    return names;
+  }();
+
+  template <typename SourceDefinition, std::size_t SinkIndex>
+  static constexpr bool kNothrowAssign = [] {
+    if constexpr (SinkIndex < kSinkCount) {
+      using SinkDefinition = typename TypeList<SinkDefinitions...>::template At<SinkIndex>;
+      return std::is_nothrow_assignable_v<decltype(SinkDefinition::SymbolType::GetValue(std::declval<Sink&>())),
+                                          const DefinitionValueType<SourceDefinition>&>;
+    } else {
+      return true;
+    }
+  }();
+
+  static constexpr bool kNothrow = [] {
+    return []<std::size_t... Is>(std::index_sequence<Is...>) {
+      return (kNothrowAssign<typename TypeList<SourceDefinitions...>::template At<Is>, kSinkIndices[Is]> && ...);
+    }(std::index_sequence_for<SourceDefinitions...>{});
+  }();
+
+  template <std::size_t I>
+  static constexpr void Assign(const Source& source, Sink& sink) noexcept(kNothrow) {
+    if constexpr (kSinkIndices[I] < kSinkCount) {
+      using SourceDefinition = typename TypeList<SourceDefinitions...>::template At<I>;
+      using SinkDefinition = typename TypeList<SinkDefinitions...>::template At<kSinkIndices[I]>;
+      SinkDefinition::SymbolType::GetValue(sink) = SourceDefinition::SymbolType::GetValue(source);
+    }
+  }
+
+  // One assignment per matched pair, selected at compile time
+  static constexpr void Map(const Source& source, Sink& sink) noexcept(kNothrow) {
+    [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+      (Assign<Is>(source, sink), ...);
+    }(std::index_sequence_for<SourceDefinitions...>{});
+  }
+};
+
+template <typename Mapping>
+struct MappingTraits {
+  static constexpr bool kIsSymbolMapping = false;
+};
+
+template <typename SourceSymbol, typename SinkSymbol, typename Function>
+struct MappingTraits<SymbolMapping<SourceSymbol, SinkSymbol, Function>> {
+  static constexpr bool kIsSymbolMapping = true;
+  using SourceSymbolType = SourceSymbol;
+  using SinkSymbolType = SinkSymbol;
+  using FunctionType = Function;
+};
+
+// True for default mappings between data members of the same trivially copyable type, which can be copied as bytes
+template <typename Mapping, typename Source, typename Sink>
+[[nodiscard]] consteval bool IsBytewiseMapping() noexcept {
+  using Traits = MappingTraits<Mapping>;
+  if constexpr (!Traits::kIsSymbolMapping) {
+    return false;
+  } else if constexpr (!std::same_as<typename Traits::FunctionType, DefaultSymbolMappingFunction> ||
+                       !Traits::SourceSymbolType::template is_owner_of<Source>() ||
+                       !Traits::SinkSymbolType::template is_owner_of<Sink>()) {
+    return false;
+  } else {
+    constexpr auto kSourceMember = Traits::SourceSymbolType::template get_member<Source>();
+    constexpr auto kSinkMember = Traits::SinkSymbolType::template get_member<Sink>();
+    // Fields of aggregate_meta types have no member pointer to copy through, so they are mapped one by one
+    if constexpr (!std::is_member_object_pointer_v<decltype(kSourceMember)> ||
+                  !std::is_member_object_pointer_v<decltype(kSinkMember)>) {
+      return false;
+    } else {
+      using SourceMember = decltype(std::declval<const Source&>().*kSourceMember);
+      using SinkMember = decltype(std::declval<Sink&>().*kSinkMember);
+      return std::same_as<std::remove_cvref_t<SourceMember>, std::remove_cvref_t<SinkMember>> &&
+             std::is_trivially_copyable_v<std::remove_cvref_t<SinkMember>> &&
+             !std::is_const_v<std::remove_reference_t<SinkMember>>;
+    }
+  }
+}
+
+struct CopyRun {
+  std::size_t source_offset;
+  std::size_t sink_offset;
+  std::size_t size;
+};
+
+template <std::size_t N>
+struct CopyRuns {
+  std::array<CopyRun, N> runs = {};
+  std::size_t count = 0;
+};
+
+template <typename Source, typename Sink, typename... Mappings>
+struct RangeMappingPlan {
+  static constexpr std::array<bool, sizeof...(Mappings)> kBytewise = {IsBytewiseMapping<Mappings, Source, Sink>()...};
+  static constexpr std::size_t kBytewiseCount =
+      static_cast<std::size_t>(std::count(kBytewise.begin(), kBytewise.end(), true));
+
+  template <typename Mapping>
+    requires(IsBytewiseMapping<Mapping, Source, Sink>())
+  [[nodiscard]] static CopyRun RunOf() noexcept {
+    using Traits = MappingTraits<Mapping>;
+    constexpr auto kSourceMember = Traits::SourceSymbolType::template get_member<Source>();
+    constexpr auto kSinkMember = Traits::SinkSymbolType::template get_member<Sink>();
+    return {MemberOffset<Source>(kSourceMember), MemberOffset<Sink>(kSinkMember),
+            sizeof(std::remove_cvref_t<decltype(std::declval<Sink&>().*kSinkMember)>)};
+  }
+
+  // Member offsets are only known at runtime, so the runs are merged once per instantiation and cached
+  [[nodiscard]] static const CopyRuns<kBytewiseCount>& Runs() {
+    static const CopyRuns<kBytewiseCount> kRuns = [] {
+      CopyRuns<kBytewiseCount> result;
+      std::array<CopyRun, kBytewiseCount> runs = {};
+      std::size_t count = 0;
+      ([&] {
+        if constexpr (IsBytewiseMapping<Mappings, Source, Sink>()) {
+          runs[count++] = RunOf<Mappings>();
+        }
+      }(), ...);
+      std::sort(runs.begin(), runs.end(),
+                [](const CopyRun& lhs, const CopyRun& rhs) { return lhs.source_offset < rhs.source_offset; });
+      // Fields that follow each other without a gap in both layouts become one copy
+      for (const CopyRun& run : runs) {
+        CopyRun* last = result.count == 0 ? nullptr : &result.runs[result.count - 1];
+        if (last != nullptr && last->source_offset + last->size == run.source_offset &&
+            last->sink_offset + last->size == run.sink_offset) {
+          last->size += run.size;
+        } else {
+          result.runs[result.count++] = run;
+        }
+      }
+      return result;
+    }();
+    return kRuns;
+  }
+
+  template <std::size_t I, typename Mapping>
+  static void ApplyMapping(std::span<const Source> source, std::span<Sink> sink, const Mapping& mapping) {
+    if constexpr (!kBytewise[I]) {
+      for (std::size_t i = 0; i < sink.size(); ++i) {
+        mapping(source[i], sink[i]);
+      }
+    }
+  }
+
+  static void Apply(std::span<const Source> source, std::span<Sink> sink, const Mappings&... mappings) {
+    if constexpr (kBytewiseCount != 0) {
+      const auto& runs = Runs();
+      const auto* source_bytes = reinterpret_cast<const std::byte*>(source.data());
+      auto* sink_bytes = reinterpret_cast<std::byte*>(sink.data());
+      if (sizeof(Source) == sizeof(Sink) && runs.count == 1 && runs.runs[0].source_offset == 0 &&
+          runs.runs[0].sink_offset == 0 && runs.runs[0].size == sizeof(Sink)) {
+        // The mappings cover every byte of both types, so the whole batch is a single copy
+        if (!sink.empty()) {
+          std::memcpy(sink_bytes, source_bytes, sink.size() * sizeof(Sink));
+        }
+      } else {
+        for (std::size_t r = 0; r < runs.count; ++r) {
+          const CopyRun& run = runs.runs[r];
+          for (std::size_t i = 0; i < sink.size(); ++i) {
+            std::memcpy(sink_bytes + i * sizeof(Sink) + run.sink_offset,
+                        source_bytes + i * sizeof(Source) + run.source_offset, run.size);
+          }
+        }
+      }
+    }
+    [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+      (ApplyMapping<Is>(source, sink, mappings), ...);
+    }(std::index_sequence_for<Mappings...>{});
+  }
+};
+
 }  // namespace ctti::detail
@@ -118,6 +118,17 @@ struct CatMany<First, Second, Rest...> {
 template <typename... Lists>
 using CatManyType = typename CatMany<Lists...>::type;
 
+template <template <typename> typename Predicate, typename List>
+struct Filter;
+
+template <template <typename> typename Predicate, typename... Ts>
+struct Filter<Predicate, TypeList<Ts...>> {
+  using type = CatManyType<TypeList<>, std::conditional_t<Predicate<Ts>::value, TypeList<Ts>, TypeList<>>...>;
+};
+
+template <template <typename> typename Predicate, typename List>
+using FilterType = TypeOf<Filter<Predicate, List>>;
+
 template <std::uint8_t I>
 using UInt8 = std::integral_constant<std::uint8_t, I>;
 
@@ -0,0 +1,177 @@
+#pragma once
+
+#include <ctti/attributes.hpp>
+#include <ctti/detail/meta.hpp>
+#include <ctti/detail/reflection_impl.hpp>
+#include <ctti/reflection.hpp>
+
+#include <array>
+#include <bit>
+#include <climits>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+namespace ctti::detail {
+
+constexpr std::size_t kPackedWordBits = 64;
+
+template <typename Value>
+concept PackableValue = std::is_integral_v<Value> || std::is_enum_v<Value> ||
+                        (std::is_floating_point_v<Value> && (sizeof(Value) == 4 || sizeof(Value) == 8));
+
+template <typename Value>
+constexpr std::size_t kNaturalBitWidth = std::same_as<Value, bool> ? 1 : sizeof(Value) * CHAR_BIT;
+
+template <typename Attribute>
+struct IsBitsAttribute : FalseType {};
+
+template <std::size_t Width>
+struct IsBitsAttribute<bits<Width>> : TrueType {};
+
+template <typename AttributeList>
+struct BitsOf;
+
+// The width of the last bits attribute, or 0 if there is none
+template <typename... Attributes>
+struct BitsOf<TypeList<Attributes...>> {
+  static constexpr std::size_t kValue = [] {
+    std::size_t width = 0;
+    ([&] {
+      if constexpr (IsBitsAttribute<Attributes>::value) {
+        width = Attributes::width;
+      }
+    }(), ...);
+    return width;
+  }();
+};
+
+template <typename Definition>
+constexpr std::size_t kPackedWidth = BitsOf<typename Definition::AttributesType>::kValue != 0
+                                         ? BitsOf<typename Definition::AttributesType>::kValue
+                                         : kNaturalBitWidth<DefinitionValueType<Definition>>;
+
+[[nodiscard]] constexpr std::uint64_t LowMask(std::size_t width) noexcept {
+  return width >= kPackedWordBits ? ~std::uint64_t{0} : (std::uint64_t{1} << width) - 1;
+}
+
+template <typename Value>
+[[nodiscard]] constexpr std::uint64_t ToPackedBits(Value value) noexcept {
+  if constexpr (std::is_enum_v<Value>) {
+    return ToPackedBits(static_cast<std::underlying_type_t<Value>>(value));
+  } else if constexpr (std::is_floating_point_v<Value>) {
+    using Bits = std::conditional_t<sizeof(Value) == 4, std::uint32_t, std::uint64_t>;
+    return static_cast<std::uint64_t>(std::bit_cast<Bits>(value));
+  } else {
+    return static_cast<std::uint64_t>(value);
+  }
+}
+
+// Signed values are sign-extended from their packed width
+template <typename Value, std::size_t Width>
+[[nodiscard]] constexpr Value FromPackedBits(std::uint64_t bits) noexcept {
+  if constexpr (std::is_enum_v<Value>) {
+    return static_cast<Value>(FromPackedBits<std::underlying_type_t<Value>, Width>(bits));
+  } else if constexpr (std::is_floating_point_v<Value>) {
+    using Bits = std::conditional_t<sizeof(Value) == 4, std::uint32_t, std::uint64_t>;
+    return std::bit_cast<Value>(static_cast<Bits>(bits));
+  } else if constexpr (std::same_as<Value, bool>) {
+    return bits != 0;
+  } else if constexpr (std::is_signed_v<Value> && Width < kPackedWordBits) {
+    constexpr std::size_t kShift = kPackedWordBits - Width;
+    return static_cast<Value>(static_cast<std::int64_t>(bits << kShift) >> kShift);
+  } else {
+    return static_cast<Value>(bits);
+  }
+}
+
+template <typename T, typename DefinitionList>
+struct PackedLayout;
+
+template <typename T, typename... Definitions>
+struct PackedLayout<T, TypeList<Definitions...>> {
+  static constexpr bool kPackable = (PackableValue<DefinitionValueType<Definitions>> && ...);
+
+  static constexpr std::array<std::size_t, sizeof...(Definitions)> kWidths = {kPackedWidth<Definitions>...};
+
+  // Fields are laid out back to back in reflection order and may straddle two words
+  static constexpr std::array<std::size_t, sizeof...(Definitions)> kOffsets = [] {
+    std::array<std::size_t, sizeof...(Definitions)> offsets = {};
+    std::size_t offset = 0;
+    for (std::size_t i = 0; i < offsets.size(); ++i) {
+      offsets[i] = offset;
+      offset += kWidths[i];
+    }
+    return offsets;
+  }();
+
+  static constexpr std::size_t kBitCount = (std::size_t{0} + ... + kPackedWidth<Definitions>);
+  static constexpr std::size_t kWordCount = (kBitCount + kPackedWordBits - 1) / kPackedWordBits;
+
+  using WordsType = std::array<std::uint64_t, kWordCount>;
+
+  template <std::size_t I, typename Definition>
+  static constexpr void PackField(const T& object, WordsType& words) noexcept {
+    static_assert(kWidths[I] <= kNaturalBitWidth<DefinitionValueType<Definition>>,
+                  "ctti::bits is wider than the data member");
+    static_assert(!std::is_floating_point_v<DefinitionValueType<Definition>> ||
+                      kWidths[I] == kNaturalBitWidth<DefinitionValueType<Definition>>,
+                  "ctti::bits does not apply to floating-point data members");
+    constexpr std::size_t kWord = kOffsets[I] / kPackedWordBits;
+    constexpr std::size_t kShift = kOffsets[I] % kPackedWordBits;
+    const std::uint64_t bits = ToPackedBits(Definition::SymbolType::GetValue(object)) & LowMask(kWidths[I]);
+    words[kWord] |= bits << kShift;
+    if constexpr (kShift + kWidths[I] > kPackedWordBits) {
+      words[kWord + 1] |= bits >> (kPackedWordBits - kShift);
+    }
+  }
+
+  template <std::size_t I, typename Definition>
+  static constexpr void UnpackField(const WordsType& words, T& object) noexcept {
+    constexpr std::size_t kWord = kOffsets[I] / kPackedWordBits;
+    constexpr std::size_t kShift = kOffsets[I] % kPackedWordBits;
+    std::uint64_t bits = words[kWord] >> kShift;
+    if constexpr (kShift + kWidths[I] > kPackedWordBits) {
+      bits |= words[kWord + 1] << (kPackedWordBits - kShift);
+    }
+    using Value = DefinitionValueType<Definition>;
+    Definition::SymbolType::GetValue(object) = FromPackedBits<Value, kWidths[I]>(bits & LowMask(kWidths[I]));
+  }
+
+  template <std::size_t I, typename Definition>
+  [[nodiscard]] static constexpr bool FieldFits(const T& object) noexcept {
+    using Value = DefinitionValueType<Definition>;
+    if constexpr (std::is_floating_point_v<Value>) {
+      return true;
+    } else {
+      const Value& value = Definition::SymbolType::GetValue(object);
+      return FromPackedBits<Value, kWidths[I]>(ToPackedBits(value) & LowMask(kWidths[I])) == value;
+    }
+  }
+
+  static constexpr void Pack(const T& object, WordsType& words) noexcept {
+    words = {};
+    [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+      (PackField<Is, Definitions>(object, words), ...);
+    }(std::index_sequence_for<Definitions...>{});
+  }
+
+  static constexpr void Unpack(const WordsType& words, T& object) noexcept {
+    [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+      (UnpackField<Is, Definitions>(words, object), ...);
+    }(std::index_sequence_for<Definitions...>{});
+  }
+
+  [[nodiscard]] static constexpr bool Fits(const T& object) noexcept {
+    return [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+      return (FieldFits<Is, Definitions>(object) && ...);
+    }(std::index_sequence_for<Definitions...>{});
+  }
+};
+
+template <reflectable T>
+using PackedLayoutOf = PackedLayout<T, DataMemberDefinitionsOf<T>>;
+
+}  // namespace ctti::detail
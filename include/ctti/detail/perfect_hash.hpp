@@ -0,0 +1,124 @@
+#pragma once
+
+#include <ctti/detail/hash_impl.hpp>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace ctti::detail {
+
+template <typename Key>
+concept PerfectHashKey = std::same_as<Key, std::string_view> || std::unsigned_integral<Key>;
+
+template <PerfectHashKey Key>
+[[nodiscard]] constexpr HashType HashKey(Key key, HashType seed) noexcept {
+  if constexpr (std::same_as<Key, std::string_view>) {
+    return Fnv1aHash(key, seed);
+  } else {
+    // Keys that are hashes already only need to be remixed with the seed
+    std::uint64_t value = (static_cast<std::uint64_t>(key) ^ seed) * 0x9E3779B97F4A7C15ULL;
+    value ^= value >> 29;
+    return static_cast<HashType>(value);
+  }
+}
+
+// Hash-and-displace perfect hash over a fixed set of distinct keys. Keys are spread over buckets by their plain
+// hash, and every bucket gets the first displacement that maps all of its keys to free slots. A lookup costs two
+// hashes and a single key comparison.
+template <std::size_t N, PerfectHashKey Key = std::string_view>
+class PerfectHashIndex {
+public:
+  static constexpr std::size_t kBucketCount = std::bit_ceil(std::max<std::size_t>(N / 2, 1));
+  static constexpr std::size_t kSlotCount = std::bit_ceil(std::max<std::size_t>(N * 2, 1));
+
+  consteval explicit PerfectHashIndex(const std::array<Key, N>& keys) : keys_(keys) {
+    std::array<std::size_t, N> bucket_of = {};
+    std::array<std::size_t, kBucketCount> bucket_sizes = {};
+    for (std::size_t i = 0; i < N; ++i) {
+      bucket_of[i] = HashKey(keys[i], kFnvBasis) & (kBucketCount - 1);
+      ++bucket_sizes[bucket_of[i]];
+    }
+
+    slots_.fill(N);
+    std::array<bool, kBucketCount> placed = {};
+    for (std::size_t round = 0; round < kBucketCount; ++round) {
+      // Place the largest remaining bucket first, while most slots are still free
+      std::size_t bucket = 0;
+      for (std::size_t b = 0; b < kBucketCount; ++b) {
+        if (!placed[b] && (placed[bucket] || bucket_sizes[b] > bucket_sizes[bucket])) {
+          bucket = b;
+        }
+      }
+      placed[bucket] = true;
+      if (bucket_sizes[bucket] != 0) {
+        PlaceBucket(bucket, bucket_of);
+      }
+    }
+  }
+
+  /**
+   * @brief Finds the index of a key.
+   * @param key The key to look up.
+   * @return The index of the key in the array the index was built from, or N if it is not one of the keys.
+   */
+  [[nodiscard]] constexpr std::size_t Find(Key key) const noexcept {
+    if constexpr (N == 0) {
+      return 0;
+    } else {
+      const std::size_t bucket = HashKey(key, kFnvBasis) & (kBucketCount - 1);
+      const std::size_t index = slots_[SlotOf(key, displacements_[bucket])];
+      return index < N && keys_[index] == key ? index : N;
+    }
+  }
+
+private:
+  [[nodiscard]] static constexpr std::size_t SlotOf(Key key, std::size_t displacement) noexcept {
+    return HashKey(key, kFnvBasis ^ (static_cast<HashType>(displacement) * kFnvPrime)) & (kSlotCount - 1);
+  }
+
+  consteval void PlaceBucket(std::size_t bucket, const std::array<std::size_t, N>& bucket_of) {
+    constexpr std::size_t kMaxDisplacement = std::size_t{1} << 20;
+    for (std::size_t displacement = 1; displacement < kMaxDisplacement; ++displacement) {
+      if (Fits(bucket, bucket_of, displacement)) {
+        for (std::size_t i = 0; i < N; ++i) {
+          if (bucket_of[i] == bucket) {
+            slots_[SlotOf(keys_[i], displacement)] = i;
+          }
+        }
+        displacements_[bucket] = displacement;
+        return;
+      }
+    }
+    throw "Failed to build a perfect hash, the keys must be distinct";
+  }
+
+  [[nodiscard]] consteval bool Fits(std::size_t bucket, const std::array<std::size_t, N>& bucket_of,
+                                    std::size_t displacement) const {
+    for (std::size_t i = 0; i < N; ++i) {
+      if (bucket_of[i] != bucket) {
+        continue;
+      }
+      const std::size_t slot = SlotOf(keys_[i], displacement);
+      if (slots_[slot] != N) {
+        return false;
+      }
+      for (std::size_t j = 0; j < i; ++j) {
+        if (bucket_of[j] == bucket && SlotOf(keys_[j], displacement) == slot) {
+          return false;
+        }
+      }
+    }
+    return true;
+  }
+
+  std::array<Key, N> keys_ = {};
+  std::array<std::size_t, kBucketCount> displacements_ = {};
+  std::array<std::size_t, kSlotCount> slots_ = {};
+};
+
+}  // namespace ctti::detail
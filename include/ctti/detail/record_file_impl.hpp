@@ -0,0 +1,128 @@
+#pragma once
+
+#include <ctti/detail/compile_time_string.hpp>
+#include <ctti/detail/flatten_impl.hpp>
+#include <ctti/detail/hash_impl.hpp>
+#include <ctti/detail/meta.hpp>
+#include <ctti/detail/schema_hash_impl.hpp>
+#include <ctti/reflection.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <ios>
+#include <ostream>
+#include <span>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace ctti::detail {
+
+// file      := header chunk* directory footer
+// chunk     := one column block per leaf, each aligned to kRecordColumnAlignment from the start of the file
+// directory := RecordFileColumn[column_count] (record_count, column_offset[column_count])[chunk_count]
+// All integers are stored in the native byte order of the writer. The header holds kRecordFileByteOrderMark, which
+// reads back as a different value on a machine with the other byte order.
+constexpr std::array<char, 8> kRecordFileMagic = {'C', 'T', 'T', 'I', 'R', 'E', 'C', 'F'};
+constexpr std::uint32_t kRecordFileFormatVersion = 2;
+constexpr std::uint32_t kRecordFileByteOrderMark = 0x01020304;
+constexpr std::size_t kRecordColumnAlignment = 64;
+
+struct RecordFileHeader {
+  std::array<char, 8> magic;
+  std::uint32_t format_version;
+  std::uint32_t byte_order_mark;
+  std::uint32_t column_count;
+  std::uint32_t reserved;
+  std::uint64_t schema_hash;
+};
+
+struct RecordFileColumn {
+  std::uint64_t name_hash;
+  std::uint32_t element_size;
+  std::uint32_t element_alignment;
+};
+
+struct RecordFileFooter {
+  std::uint64_t directory_offset;
+  std::uint64_t chunk_count;
+  std::uint64_t record_count;
+  std::array<char, 8> magic;
+};
+
+template <typename T>
+[[nodiscard]] T LoadRecordFileValue(std::span<const std::byte> bytes, std::size_t offset) noexcept {
+  T value;
+  std::memcpy(&value, bytes.data() + offset, sizeof(T));
+  return value;
+}
+
+template <typename T, typename PathList>
+struct RecordColumns;
+
+// The columns of a record file are the leaves of T, with nested reflectable data members flattened
+template <typename T, typename... Paths>
+struct RecordColumns<T, TypeList<Paths...>> {
+  template <std::size_t I>
+  using ValueType = std::remove_cv_t<PathValueType<T, typename TypeList<Paths...>::template At<I>>>;
+
+  static constexpr std::size_t kCount = sizeof...(Paths);
+  static constexpr std::array<std::string_view, kCount> kNames = {PathName<Paths>::kValue...};
+  static constexpr bool kStorable = (std::is_trivially_copyable_v<PathValueType<T, Paths>> && ...);
+
+  static constexpr std::array<RecordFileColumn, kCount> kColumns = {
+      RecordFileColumn{Fnv1aHash(PathName<Paths>::kValue), sizeof(PathValueType<T, Paths>),
+                       alignof(PathValueType<T, Paths>)}...};
+
+  template <CompileTimeString Name>
+  static constexpr std::size_t kIndexOf = [] {
+    for (std::size_t i = 0; i < kCount; ++i) {
+      if (kNames[i] == Name.View()) {
+        return i;
+      }
+    }
+    return kCount;
+  }();
+
+  // Writes one block per column, gathering the values of a leaf from every record into a reused scratch buffer
+  static void WriteChunk(std::ostream& stream, std::span<const T> records, std::uint64_t& position,
+                         std::vector<std::byte>& scratch, std::array<std::uint64_t, kCount>& offsets) {
+    std::size_t column = 0;
+    (
+        [&] {
+          using Value = PathValueType<T, Paths>;
+          const std::uint64_t aligned =
+              (position + kRecordColumnAlignment - 1) / kRecordColumnAlignment * kRecordColumnAlignment;
+          scratch.assign(static_cast<std::size_t>(aligned - position) + records.size() * sizeof(Value), std::byte{0});
+          std::byte* out = scratch.data() + (aligned - position);
+          for (const T& record : records) {
+            std::memcpy(out, std::addressof(PathAccess<Paths>::Get(record)), sizeof(Value));
+            out += sizeof(Value);
+          }
+          stream.write(reinterpret_cast<const char*>(scratch.data()), static_cast<std::streamsize>(scratch.size()));
+          offsets[column++] = aligned;
+          position += scratch.size();
+        }(),
+        ...);
+  }
+};
+
+template <reflectable T>
+using RecordColumnsOf = RecordColumns<T, LeafPathsType<T>>;
+
+// Streams only record failures in their state, so every chunk and the closing directory check it
+inline void CheckRecordFileStream(const std::ostream& stream) {
+  if (!stream.good()) {
+    throw std::ios_base::failure("ctti::record_file_writer: writing to the stream failed");
+  }
+}
+
+template <typename Value>
+void WriteRecordFileValue(std::ostream& stream, const Value& value, std::uint64_t& position) {
+  stream.write(reinterpret_cast<const char*>(&value), sizeof(Value));
+  position += sizeof(Value);
+}
+
+}  // namespace ctti::detail
@@ -0,0 +1,136 @@
+#pragma once
+
+#include <ctti/detail/hash_impl.hpp>
+#include <ctti/detail/meta.hpp>
+#include <ctti/detail/reflection_impl.hpp>
+#include <ctti/reflection.hpp>
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <ranges>
+#include <type_traits>
+
+namespace ctti::detail {
+
+constexpr std::uint64_t kHashMultiplier = 0x9E3779B97F4A7C15ULL;
+
+// SplitMix64 finalizer
+[[nodiscard]] constexpr std::uint64_t MixHash(std::uint64_t value) noexcept {
+  value ^= value >> 30;
+  value *= 0xBF58476D1CE4E5B9ULL;
+  value ^= value >> 27;
+  value *= 0x94D049BB133111EBULL;
+  value ^= value >> 31;
+  return value;
+}
+
+[[nodiscard]] constexpr HashType HashCombine(HashType seed, HashType value) noexcept {
+  return seed ^ (value + static_cast<HashType>(kHashMultiplier) + (seed << 6) + (seed >> 2));
+}
+
+[[nodiscard]] inline std::uint64_t LoadWord(const std::byte* data) noexcept {
+  std::uint64_t word = 0;
+  std::memcpy(&word, data, sizeof(word));
+  return word;
+}
+
+// Hashes a byte range a word at a time. The main loop runs four independent lanes so that the compiler can keep
+// them in vector registers.
+[[nodiscard]] inline HashType HashBytes(const std::byte* data, std::size_t size,
+                                       std::uint64_t seed = kFnvBasis) noexcept {
+  constexpr std::size_t kLaneCount = 4;
+  constexpr std::size_t kBlockSize = kLaneCount * sizeof(std::uint64_t);
+
+  std::array<std::uint64_t, kLaneCount> lanes = {seed, seed ^ kHashMultiplier, seed + kHashMultiplier, ~seed};
+  std::size_t offset = 0;
+  for (; offset + kBlockSize <= size; offset += kBlockSize) {
+    for (std::size_t lane = 0; lane < kLaneCount; ++lane) {
+      lanes[lane] = (lanes[lane] ^ LoadWord(data + offset + lane * sizeof(std::uint64_t))) * kHashMultiplier;
+      lanes[lane] ^= lanes[lane] >> 32;
+    }
+  }
+
+  std::uint64_t hash = MixHash(seed ^ (static_cast<std::uint64_t>(size) * kHashMultiplier));
+  for (const std::uint64_t lane : lanes) {
+    hash = MixHash(hash ^ lane);
+  }
+
+  for (; offset + sizeof(std::uint64_t) <= size; offset += sizeof(std::uint64_t)) {
+    hash = MixHash(hash ^ LoadWord(data + offset));
+  }
+
+  if (offset < size) {
+    std::uint64_t tail = 0;
+    std::memcpy(&tail, data + offset, size - offset);
+    hash = MixHash(hash ^ tail);
+  }
+
+  return static_cast<HashType>(hash);
+}
+
+template <typename T>
+concept StdHashable = requires(const T& value) {
+  { std::hash<T>{}(value) } -> std::convertible_to<std::size_t>;
+};
+
+template <typename T>
+[[nodiscard]] consteval bool IsReflectedHashable() noexcept {
+  if constexpr (reflectable<T>) {
+    return []<typename... Definitions>(TypeList<Definitions...>) {
+      return (IsReflectedHashable<DefinitionValueType<Definitions>>() && ...);
+    }(DataMemberDefinitionsOf<T>{});
+  } else if constexpr (StdHashable<T>) {
+    return true;
+  } else if constexpr (std::ranges::input_range<const T>) {
+    return IsReflectedHashable<std::remove_cvref_t<std::ranges::range_value_t<const T>>>();
+  } else {
+    return false;
+  }
+}
+
+template <typename T>
+concept ReflectedHashable = IsReflectedHashable<T>();
+
+template <typename T>
+[[nodiscard]] HashType HashValue(const T& value);
+
+template <reflectable T>
+[[nodiscard]] HashType HashObject(const T& object) {
+  if constexpr (kReflectsObjectRepresentation<T>) {
+    return HashBytes(reinterpret_cast<const std::byte*>(std::addressof(object)), sizeof(T));
+  } else {
+    HashType seed = kFnvBasis;
+    [&]<typename... Definitions>(TypeList<Definitions...>) {
+      ((seed = HashCombine(seed, HashValue(Definitions::SymbolType::GetValue(object)))), ...);
+    }(DataMemberDefinitionsOf<T>{});
+    return static_cast<HashType>(MixHash(seed));
+  }
+}
+
+template <typename T>
+HashType HashValue(const T& value) {
+  if constexpr (reflectable<T>) {
+    return HashObject(value);
+  } else if constexpr (StdHashable<T>) {
+    return std::hash<T>{}(value);
+  } else if constexpr (std::ranges::contiguous_range<const T> &&
+                       IsBytewiseComparable<std::remove_cvref_t<std::ranges::range_value_t<const T>>>()) {
+    return HashBytes(reinterpret_cast<const std::byte*>(std::ranges::data(value)),
+                     std::ranges::size(value) * sizeof(std::ranges::range_value_t<const T>));
+  } else {
+    HashType seed = kFnvBasis;
+    std::size_t count = 0;
+    for (const auto& element : value) {
+      seed = HashCombine(seed, HashValue(element));
+      ++count;
+    }
+    return HashCombine(seed, count);
+  }
+}
+
+}  // namespace ctti::detail
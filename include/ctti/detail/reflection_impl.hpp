@@ -6,6 +6,7 @@
 #include <array>
 #include <concepts>
 #include <cstddef>
+#include <memory>
 #include <optional>
 #include <string_view>
 #include <tuple>
@@ -13,11 +14,58 @@
 
 namespace ctti::detail {
 
+template <typename Definition>
+concept DataMemberDefinition = requires {
+  Definition::kPointer;
+  requires MemberTraits<std::remove_cvref_t<decltype(Definition::kPointer)>>::kIsDataMember;
+};
+
+template <typename Definition>
+struct IsDataMemberDefinition : BoolType<DataMemberDefinition<Definition>> {};
+
+template <DataMemberDefinition Definition>
+using DefinitionValueType =
+    std::remove_cv_t<typename MemberTraits<std::remove_cvref_t<decltype(Definition::kPointer)>>::value_type>;
+
+template <DataMemberDefinition Definition, typename T>
+[[nodiscard]] const std::byte* DataMemberAddress(const T& object) noexcept {
+  return reinterpret_cast<const std::byte*>(std::addressof(Definition::SymbolType::GetValue(object)));
+}
+
+template <typename DefinitionList>
+struct DataMembersSize;
+
+// Sum of the sizes of the data members in DefinitionList, used to check whether they cover a whole object
+template <typename... Definitions>
+struct DataMembersSize<TypeList<Definitions...>>
+    : SizeType<(std::size_t{0} + ... + sizeof(DefinitionValueType<Definitions>))> {};
+
+template <CompileTimeString Name, typename DefinitionList>
+struct DefinitionIndex;
+
+template <CompileTimeString Name, typename... Definitions>
+struct DefinitionIndex<Name, TypeList<Definitions...>> {
+  static constexpr std::size_t kValue = [] {
+    constexpr std::array<std::string_view, sizeof...(Definitions)> names = {Definitions::kName...};
+    for (std::size_t i = 0; i < names.size(); ++i) {
+      if (names[i] == Name.View()) {
+        return i;
+      }
+    }
+    return names.size();
+  }();
+};
+
+// Index of the definition named Name in DefinitionList, or the list size if there is none
+template <CompileTimeString Name, typename DefinitionList>
+constexpr std::size_t kDefinitionIndex = DefinitionIndex<Name, DefinitionList>::kValue;
+
 template <typename ReflectedType, typename... Definitions>
 class TypeReflection {
 public:
   using Type = ReflectedType;
   using DefinitionsType = TypeList<Definitions...>;
+  using DataMemberDefinitionsType = FilterType<IsDataMemberDefinition, DefinitionsType>;
 
   static constexpr std::size_t kSize = sizeof...(Definitions);
 
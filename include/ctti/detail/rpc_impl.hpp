@@ -0,0 +1,128 @@
+#pragma once
+
+#include <ctti/detail/compile_time_string.hpp>
+#include <ctti/detail/hash_impl.hpp>
+#include <ctti/detail/meta.hpp>
+#include <ctti/detail/perfect_hash.hpp>
+#include <ctti/detail/reflection_impl.hpp>
+#include <ctti/detail/symbol_impl.hpp>
+#include <ctti/name.hpp>
+#include <ctti/reflection.hpp>
+
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace ctti::detail {
+
+template <typename Pointer>
+struct MethodTraits {
+  static constexpr bool kIsMethod = false;
+};
+
+template <typename Return, typename Class, typename... Args>
+struct MethodTraits<Return (Class::*)(Args...)> {
+  static constexpr bool kIsMethod = true;
+  using ReturnType = Return;
+  using ArgsType = TypeList<Args...>;
+};
+
+template <typename Return, typename Class, typename... Args>
+struct MethodTraits<Return (Class::*)(Args...) const> : MethodTraits<Return (Class::*)(Args...)> {};
+
+template <typename... Args>
+[[nodiscard]] constexpr HashType SignatureHash() noexcept {
+  HashType hash = Fnv1aHash("(");
+  ((hash = Fnv1aHash(",", Fnv1aHash(name_of<std::remove_cvref_t<Args>>(), hash))), ...);
+  return Fnv1aHash(")", hash);
+}
+
+template <typename ArgList>
+struct ListSignatureHash;
+
+template <typename... Args>
+struct ListSignatureHash<TypeList<Args...>> : std::integral_constant<HashType, SignatureHash<Args...>()> {};
+
+// Continues the signature hash with the method name, so that overloads of a method get distinct keys
+[[nodiscard]] constexpr HashType MethodKey(std::string_view name, HashType signature) noexcept {
+  return Fnv1aHash(name, signature);
+}
+
+template <CompileTimeString Name, auto Pointer>
+struct MethodEntry {
+  using TraitsType = MethodTraits<std::remove_cvref_t<decltype(Pointer)>>;
+
+  static constexpr auto kPointer = Pointer;
+  static constexpr HashType kKey = MethodKey(Name.View(), ListSignatureHash<typename TraitsType::ArgsType>::value);
+};
+
+template <CompileTimeString Name, auto... Pointers>
+using MethodEntriesType =
+    CatManyType<TypeList<>,
+                std::conditional_t<MethodTraits<std::remove_cvref_t<decltype(Pointers)>>::kIsMethod,
+                                   TypeList<MethodEntry<Name, Pointers>>, TypeList<>>...>;
+
+template <typename Definition>
+struct MethodEntries {
+  using Type = TypeList<>;
+};
+
+template <CompileTimeString Name, auto Pointer, typename... Attributes>
+struct MethodEntries<SymbolDefinition<Name, Pointer, Attributes...>> {
+  using Type = MethodEntriesType<Name, Pointer>;
+};
+
+template <CompileTimeString Name, typename AttributeList, auto... Pointers>
+struct MethodEntries<OverloadedSymbolDefinition<Name, AttributeList, Pointers...>> {
+  using Type = MethodEntriesType<Name, Pointers...>;
+};
+
+template <typename DefinitionList>
+struct MethodEntriesOf;
+
+// One entry per member function pointer, with the overloads of an overloaded member listed separately
+template <typename... Definitions>
+struct MethodEntriesOf<TypeList<Definitions...>> {
+  using Type = CatManyType<TypeList<>, typename MethodEntries<Definitions>::Type...>;
+};
+
+// Reads the arguments in declaration order from the reader, invokes the method and writes its result, if any
+template <typename Entry, typename T, typename Reader, typename Writer>
+void InvokeMethod(T& object, Reader& reader, Writer& writer) {
+  [&]<typename... Args>(TypeList<Args...>) {
+    // Braced initialization evaluates the reads left to right
+    std::tuple<std::remove_cvref_t<Args>...> arguments{reader.template read<std::remove_cvref_t<Args>>()...};
+    std::apply(
+        [&](auto&... values) {
+          if constexpr (std::is_void_v<typename Entry::TraitsType::ReturnType>) {
+            std::invoke(Entry::kPointer, object, static_cast<Args&&>(values)...);
+          } else {
+            writer.write(std::invoke(Entry::kPointer, object, static_cast<Args&&>(values)...));
+          }
+        },
+        arguments);
+  }(typename Entry::TraitsType::ArgsType{});
+}
+
+template <typename T, typename Reader, typename Writer, typename EntryList>
+struct DispatchTable;
+
+template <typename T, typename Reader, typename Writer, typename... Entries>
+struct DispatchTable<T, Reader, Writer, TypeList<Entries...>> {
+  using ThunkType = void (*)(T&, Reader&, Writer&);
+
+  static constexpr std::size_t kCount = sizeof...(Entries);
+  static constexpr std::array<HashType, kCount> kKeys = {Entries::kKey...};
+  static constexpr PerfectHashIndex<kCount, HashType> kIndex{kKeys};
+  static constexpr std::array<ThunkType, kCount> kThunks = {&InvokeMethod<Entries, T, Reader, Writer>...};
+};
+
+template <reflectable T, typename Reader, typename Writer>
+using DispatchTableOf =
+    DispatchTable<T, Reader, Writer, typename MethodEntriesOf<typename ReflectionOf<T>::DefinitionsType>::Type>;
+
+}  // namespace ctti::detail
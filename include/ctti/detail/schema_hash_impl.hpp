@@ -0,0 +1,96 @@
+#pragma once
+
+#include <ctti/detail/layout_info_impl.hpp>
+#include <ctti/detail/meta.hpp>
+#include <ctti/detail/reflection_impl.hpp>
+#include <ctti/name.hpp>
+#include <ctti/reflection.hpp>
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <ranges>
+#include <string_view>
+#include <type_traits>
+
+namespace ctti::detail {
+
+// Schema hashes are stored in files and messages, so they are 64 bits wide on every platform instead of size_t
+using SchemaHashType = std::uint64_t;
+
+constexpr SchemaHashType kSchemaFnvBasis = 14695981039346656037ULL;
+constexpr SchemaHashType kSchemaFnvPrime = 1099511628211ULL;
+
+[[nodiscard]] constexpr SchemaHashType SchemaMix(std::string_view str, SchemaHashType hash) noexcept {
+  for (const char ch : str) {
+    hash = (hash ^ static_cast<unsigned char>(ch)) * kSchemaFnvPrime;
+  }
+  return hash;
+}
+
+// Mixes the value one byte at a time from the least significant end, so the result does not depend on byte order
+[[nodiscard]] constexpr SchemaHashType SchemaMix(std::uint64_t value, SchemaHashType hash) noexcept {
+  for (int i = 0; i < 8; ++i) {
+    hash = (hash ^ ((value >> (i * 8)) & 0xFFU)) * kSchemaFnvPrime;
+  }
+  return hash;
+}
+
+template <typename Value>
+concept ReflectableRange = std::ranges::range<Value> && reflectable<std::ranges::range_value_t<Value>>;
+
+template <reflectable T>
+[[nodiscard]] constexpr SchemaHashType SchemaHash() noexcept;
+
+// Reflectable values contribute their own schema instead of their type name, so that renaming a nested type keeps
+// the schema. The same goes for the elements of ranges of reflectable values.
+template <typename Value>
+[[nodiscard]] constexpr SchemaHashType ValueSchemaHash(SchemaHashType hash) noexcept {
+  hash = SchemaMix(alignof(Value), SchemaMix(sizeof(Value), hash));
+  if constexpr (reflectable<Value>) {
+    return SchemaMix(SchemaHash<Value>(), hash);
+  } else if constexpr (ReflectableRange<Value>) {
+    return SchemaMix(SchemaHash<std::ranges::range_value_t<Value>>(), SchemaMix("[]", hash));
+  } else {
+    return SchemaMix(name_of<Value>(), hash);
+  }
+}
+
+template <typename Definition>
+[[nodiscard]] constexpr SchemaHashType DefinitionSchemaHash(SchemaHashType hash) noexcept {
+  hash = SchemaMix(":", SchemaMix(Definition::kName, hash));
+  hash = SchemaMix(";", ValueSchemaHash<DefinitionValueType<Definition>>(hash));
+  return [&]<typename... Attributes>(TypeList<Attributes...>) {
+    ((hash = SchemaMix(",", SchemaMix(name_of<Attributes>(), hash))), ...);
+    return hash;
+  }(typename Definition::AttributesType{});
+}
+
+template <reflectable T>
+[[nodiscard]] constexpr SchemaHashType SchemaHash() noexcept {
+  return [&]<typename... Definitions>(TypeList<Definitions...>) {
+    SchemaHashType hash = SchemaMix(std::endian::native == std::endian::little ? "<" : ">", kSchemaFnvBasis);
+    hash = SchemaMix("{", SchemaMix(alignof(T), SchemaMix(sizeof(T), hash)));
+    ((hash = DefinitionSchemaHash<Definitions>(hash)), ...);
+    return SchemaMix("}", hash);
+  }(DataMemberDefinitionsOf<T>{});
+}
+
+// Member offsets come from the layout probe, which cannot run in a constant expression
+template <reflectable T>
+[[nodiscard]] SchemaHashType LayoutHash() noexcept {
+  return [&]<typename... Definitions>(TypeList<Definitions...>) {
+    SchemaHashType hash = SchemaMix("@", SchemaHash<T>());
+    (
+        [&] {
+          hash = SchemaMix(DataMemberOffset<Definitions, T>(), hash);
+          if constexpr (reflectable<DefinitionValueType<Definitions>>) {
+            hash = SchemaMix(LayoutHash<DefinitionValueType<Definitions>>(), hash);
+          }
+        }(),
+        ...);
+    return hash;
+  }(DataMemberDefinitionsOf<T>{});
+}
+
+}  // namespace ctti::detail
@@ -0,0 +1,243 @@
+#pragma once
+
+#include <ctti/attributes.hpp>
+#include <ctti/detail/meta.hpp>
+#include <ctti/detail/reflection_impl.hpp>
+#include <ctti/reflection.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace ctti::detail {
+
+template <typename Attribute>
+struct IsSinceAttribute : FalseType {};
+
+// since<Version> is an attribute_value holding an int
+template <int Version>
+struct IsSinceAttribute<attribute_value<Version>> : TrueType {};
+
+template <typename AttributeList>
+struct SinceOf;
+
+// Version that introduced a symbol, 0 for symbols without a since attribute
+template <typename... Attributes>
+struct SinceOf<TypeList<Attributes...>> {
+  static constexpr int kValue = [] {
+    int version = 0;
+    ((IsSinceAttribute<Attributes>::value ? (version = std::max<int>(version, Attributes::value), 0) : 0), ...);
+    return version;
+  }();
+};
+
+template <typename Definition>
+constexpr int kSinceVersion = SinceOf<typename Definition::AttributesType>::kValue;
+
+template <typename DefinitionList>
+struct AllSerializable;
+
+// Arithmetic values, enums, strings, vectors and arrays of serializable values, and reflectable types whose data
+// members are all serializable
+template <typename T>
+struct Serializable : BoolType<std::is_arithmetic_v<T> || std::is_enum_v<T>> {};
+
+template <typename Char, typename Traits, typename Allocator>
+struct Serializable<std::basic_string<Char, Traits, Allocator>> : Serializable<Char> {};
+
+template <typename T, typename Allocator>
+struct Serializable<std::vector<T, Allocator>> : Serializable<T> {};
+
+// std::vector<bool> has no contiguous storage to read into
+template <typename Allocator>
+struct Serializable<std::vector<bool, Allocator>> : FalseType {};
+
+template <typename T, std::size_t N>
+struct Serializable<std::array<T, N>> : Serializable<T> {};
+
+template <reflectable T>
+struct Serializable<T> : AllSerializable<DataMemberDefinitionsOf<T>> {};
+
+template <typename... Definitions>
+struct AllSerializable<TypeList<Definitions...>>
+    : BoolType<(Serializable<DefinitionValueType<Definitions>>::value && ...)> {};
+
+// Elements that are written as their object representation, so that sequences of them are copied in one block
+template <typename T>
+constexpr bool kIsRawValue = !reflectable<T> && (std::is_arithmetic_v<T> || std::is_enum_v<T>);
+
+template <typename T>
+struct SchemaVersion : std::integral_constant<int, 0> {};
+
+template <typename DefinitionList>
+struct DefinitionsSchemaVersion;
+
+template <typename... Definitions>
+struct DefinitionsSchemaVersion<TypeList<Definitions...>>
+    : std::integral_constant<int, std::max<int>(
+                                      {0, kSinceVersion<Definitions>...,
+                                       SchemaVersion<DefinitionValueType<Definitions>>::value...})> {};
+
+// Highest since version among the data members of T and of every reflectable type nested in it
+template <reflectable T>
+struct SchemaVersion<T> : DefinitionsSchemaVersion<DataMemberDefinitionsOf<T>> {};
+
+template <typename T, typename Allocator>
+struct SchemaVersion<std::vector<T, Allocator>> : SchemaVersion<T> {};
+
+template <typename T, std::size_t N>
+struct SchemaVersion<std::array<T, N>> : SchemaVersion<T> {};
+
+template <typename T, int Version>
+struct SerializedSize;
+
+template <typename DefinitionList, int Version>
+struct DefinitionsSerializedSize;
+
+template <typename... Definitions, int Version>
+struct DefinitionsSerializedSize<TypeList<Definitions...>, Version> {
+  template <typename Definition>
+  using MemberSize = SerializedSize<DefinitionValueType<Definition>, Version>;
+
+  static constexpr bool kFixed = ((kSinceVersion<Definitions> > Version || MemberSize<Definitions>::kFixed) && ...);
+  static constexpr std::size_t kMinimum =
+      (std::size_t{0} + ... + (kSinceVersion<Definitions> <= Version ? MemberSize<Definitions>::kMinimum : 0));
+};
+
+// Smallest number of bytes a T takes when written at Version, and whether every T takes exactly that many
+template <typename T, int Version>
+struct SerializedSize {
+  static constexpr bool kFixed = kIsRawValue<T>;
+  static constexpr std::size_t kMinimum = kIsRawValue<T> ? sizeof(T) : sizeof(std::uint64_t);
+};
+
+template <typename T, std::size_t N, int Version>
+struct SerializedSize<std::array<T, N>, Version> {
+  static constexpr bool kFixed = SerializedSize<T, Version>::kFixed;
+  static constexpr std::size_t kMinimum = N * SerializedSize<T, Version>::kMinimum;
+};
+
+template <reflectable T, int Version>
+struct SerializedSize<T, Version> : DefinitionsSerializedSize<DataMemberDefinitionsOf<T>, Version> {};
+
+// Writes into memory that was sized up front
+struct SpanWriter {
+  std::byte* position;
+
+  void write_bytes(const void* data, std::size_t size) noexcept {
+    if (size != 0) {
+      std::memcpy(position, data, size);
+    }
+    position += size;
+  }
+};
+
+template <int Version, typename Writer, typename T>
+void WriteValue(Writer& writer, const T& value);
+
+template <int Version, typename Writer, typename Range>
+void WriteElements(Writer& writer, const Range& range) {
+  using ElementType = typename Range::value_type;
+  if constexpr (kIsRawValue<ElementType>) {
+    writer.write_bytes(range.data(), range.size() * sizeof(ElementType));
+  } else {
+    for (const auto& element : range) {
+      WriteValue<Version>(writer, element);
+    }
+  }
+}
+
+template <int Version, typename Writer, typename T>
+void WriteValue(Writer& writer, const T& value) {
+  if constexpr (reflectable<T>) {
+    // Members introduced after Version are dropped at compile time
+    [&]<typename... Definitions>(TypeList<Definitions...>) {
+      (
+          [&] {
+            if constexpr (kSinceVersion<Definitions> <= Version) {
+              WriteValue<Version>(writer, Definitions::SymbolType::GetValue(value));
+            }
+          }(),
+          ...);
+    }(DataMemberDefinitionsOf<T>{});
+  } else if constexpr (kIsRawValue<T>) {
+    writer.write_bytes(&value, sizeof(T));
+  } else if constexpr (IsStdArray<T>::value) {
+    WriteElements<Version>(writer, value);
+  } else {
+    const auto size = static_cast<std::uint64_t>(value.size());
+    writer.write_bytes(&size, sizeof(size));
+    WriteElements<Version>(writer, value);
+  }
+}
+
+template <int Version, typename Reader, typename T>
+[[nodiscard]] bool ReadValue(Reader& reader, T& value);
+
+template <int Version, typename Reader, typename T>
+[[nodiscard]] bool ReadElements(Reader& reader, T* elements, std::size_t count) {
+  if constexpr (kIsRawValue<T>) {
+    return reader.read_bytes(elements, count * sizeof(T));
+  } else {
+    for (std::size_t i = 0; i < count; ++i) {
+      if (!ReadValue<Version>(reader, elements[i])) {
+        return false;
+      }
+    }
+    return true;
+  }
+}
+
+template <int Version, typename Reader, typename T>
+[[nodiscard]] bool ReadValue(Reader& reader, T& value) {
+  if constexpr (reflectable<T>) {
+    // Members the payload predates keep their current value
+    return [&]<typename... Definitions>(TypeList<Definitions...>) {
+      return ([&] {
+        if constexpr (kSinceVersion<Definitions> <= Version) {
+          return ReadValue<Version>(reader, Definitions::SymbolType::GetValue(value));
+        } else {
+          return true;
+        }
+      }() && ...);
+    }(DataMemberDefinitionsOf<T>{});
+  } else if constexpr (kIsRawValue<T>) {
+    return reader.read_bytes(&value, sizeof(T));
+  } else if constexpr (IsStdArray<T>::value) {
+    return ReadElements<Version>(reader, value.data(), value.size());
+  } else {
+    std::uint64_t size = 0;
+    if (!reader.read_bytes(&size, sizeof(size))) {
+      return false;
+    }
+    // Rejects counts that cannot fit in the rest of the payload before allocating for them
+    constexpr std::size_t element_size = kIsRawValue<typename T::value_type> ? sizeof(typename T::value_type) : 1;
+    if (size > reader.remaining() / element_size) {
+      return false;
+    }
+    value.resize(static_cast<std::size_t>(size));
+    return ReadElements<Version>(reader, value.data(), value.size());
+  }
+}
+
+template <typename T, typename Reader, typename VersionSequence>
+struct VersionedReaders;
+
+// One reader per schema version, so that picking the version is a single indexed jump
+template <typename T, typename Reader, int... Versions>
+struct VersionedReaders<T, Reader, std::integer_sequence<int, Versions...>> {
+  static constexpr std::array<bool (*)(Reader&, T&), sizeof...(Versions)> kReaders = {
+      &ReadValue<Versions, Reader, T>...};
+};
+
+template <typename T, typename Reader>
+using VersionedReadersOf =
+    VersionedReaders<T, Reader, std::make_integer_sequence<int, SchemaVersion<T>::value + 1>>;
+
+}  // namespace ctti::detail
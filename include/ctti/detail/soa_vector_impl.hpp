@@ -0,0 +1,291 @@
+#pragma once
+
+#include <ctti/detail/compile_time_string.hpp>
+#include <ctti/detail/meta.hpp>
+#include <ctti/detail/reflection_impl.hpp>
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace ctti::detail {
+
+// Columns are aligned to a cache line so that kernels looping over a single field start on a fresh line
+constexpr std::size_t kColumnAlignment = 64;
+
+template <typename T>
+class ColumnBuffer {
+public:
+  constexpr ColumnBuffer() noexcept = default;
+  // Keeps the capacity of the source, which SoaStorage copies along with the columns
+  ColumnBuffer(const ColumnBuffer& other) : ColumnBuffer() {
+    Reserve(other.capacity_);
+    std::uninitialized_copy_n(other.data_, other.size_, data_);
+    size_ = other.size_;
+  }
+
+  ColumnBuffer(ColumnBuffer&& other) noexcept
+      : data_(std::exchange(other.data_, nullptr)),
+        size_(std::exchange(other.size_, 0)),
+        capacity_(std::exchange(other.capacity_, 0)) {}
+
+  ~ColumnBuffer() noexcept { Release(); }
+
+  ColumnBuffer& operator=(const ColumnBuffer& other) {
+    if (this != &other) {
+      ColumnBuffer copy(other);
+      Swap(copy);
+    }
+    return *this;
+  }
+
+  ColumnBuffer& operator=(ColumnBuffer&& other) noexcept {
+    if (this != &other) {
+      Release();
+      data_ = std::exchange(other.data_, nullptr);
+      size_ = std::exchange(other.size_, 0);
+      capacity_ = std::exchange(other.capacity_, 0);
+    }
+    return *this;
+  }
+
+  void Reserve(std::size_t capacity) {
+    if (capacity <= capacity_) {
+      return;
+    }
+
+    T* data = Allocate(capacity);
+    if constexpr (std::is_nothrow_move_constructible_v<T>) {
+      std::uninitialized_move_n(data_, size_, data);
+    } else {
+      try {
+        std::uninitialized_copy_n(data_, size_, data);
+      } catch (...) {
+        Deallocate(data, capacity);
+        throw;
+      }
+    }
+
+    std::destroy_n(data_, size_);
+    Deallocate(data_, capacity_);
+    data_ = data;
+    capacity_ = capacity;
+  }
+
+  void Resize(std::size_t size) {
+    if (size > size_) {
+      Reserve(size);
+      std::uninitialized_value_construct_n(data_ + size_, size - size_);
+    } else {
+      std::destroy_n(data_ + size, size_ - size);
+    }
+    size_ = size;
+  }
+
+  template <typename... Args>
+  T& EmplaceBack(Args&&... args) {
+    if (size_ == capacity_) {
+      Reserve(capacity_ == 0 ? 8 : capacity_ * 2);
+    }
+    T* element = std::construct_at(data_ + size_, std::forward<Args>(args)...);
+    ++size_;
+    return *element;
+  }
+
+  void PopBack() noexcept {
+    --size_;
+    std::destroy_at(data_ + size_);
+  }
+
+  void Clear() noexcept {
+    std::destroy_n(data_, size_);
+    size_ = 0;
+  }
+
+  void Swap(ColumnBuffer& other) noexcept {
+    std::swap(data_, other.data_);
+    std::swap(size_, other.size_);
+    std::swap(capacity_, other.capacity_);
+  }
+
+  [[nodiscard]] T* Data() noexcept { return data_; }
+  [[nodiscard]] const T* Data() const noexcept { return data_; }
+  [[nodiscard]] std::size_t Size() const noexcept { return size_; }
+  [[nodiscard]] std::size_t Capacity() const noexcept { return capacity_; }
+
+  [[nodiscard]] T& operator[](std::size_t index) noexcept { return data_[index]; }
+  [[nodiscard]] const T& operator[](std::size_t index) const noexcept { return data_[index]; }
+
+private:
+  static constexpr std::size_t kAlignment = std::max(kColumnAlignment, alignof(T));
+
+  [[nodiscard]] static T* Allocate(std::size_t capacity) {
+    return static_cast<T*>(::operator new(capacity * sizeof(T), std::align_val_t{kAlignment}));
+  }
+
+  static void Deallocate(T* data, std::size_t capacity) noexcept {
+    if (data != nullptr) {
+      ::operator delete(data, capacity * sizeof(T), std::align_val_t{kAlignment});
+    }
+  }
+
+  void Release() noexcept {
+    std::destroy_n(data_, size_);
+    Deallocate(data_, capacity_);
+    data_ = nullptr;
+    size_ = 0;
+    capacity_ = 0;
+  }
+
+  T* data_ = nullptr;
+  std::size_t size_ = 0;
+  std::size_t capacity_ = 0;
+};
+
+template <typename T, typename DefinitionList>
+class SoaStorage;
+
+template <typename T, typename... Definitions>
+class SoaStorage<T, TypeList<Definitions...>> {
+public:
+  using DefinitionsType = TypeList<Definitions...>;
+
+  static constexpr std::size_t kColumnCount = sizeof...(Definitions);
+
+  template <std::size_t I>
+    requires(I < kColumnCount)
+  using ColumnValueType = DefinitionValueType<typename DefinitionsType::template At<I>>;
+
+  template <CompileTimeString Name>
+  static constexpr std::size_t kColumnIndexOf = kDefinitionIndex<Name, DefinitionsType>;
+
+  SoaStorage() noexcept = default;
+  SoaStorage(const SoaStorage&) = default;
+
+  // The moved-from columns are empty, so the sizes are reset with them
+  SoaStorage(SoaStorage&& other) noexcept
+      : columns_(std::move(other.columns_)),
+        size_(std::exchange(other.size_, 0)),
+        capacity_(std::exchange(other.capacity_, 0)) {}
+
+  ~SoaStorage() noexcept = default;
+
+  SoaStorage& operator=(const SoaStorage&) = default;
+
+  SoaStorage& operator=(SoaStorage&& other) noexcept {
+    if (this != &other) {
+      columns_ = std::move(other.columns_);
+      size_ = std::exchange(other.size_, 0);
+      capacity_ = std::exchange(other.capacity_, 0);
+    }
+    return *this;
+  }
+
+  [[nodiscard]] std::size_t Size() const noexcept { return size_; }
+  [[nodiscard]] std::size_t Capacity() const noexcept { return capacity_; }
+
+  void Reserve(std::size_t capacity) {
+    (Column<Definitions>().Reserve(capacity), ...);
+    capacity_ = std::max(capacity_, capacity);
+  }
+
+  void Resize(std::size_t size) {
+    Reserve(size);
+    (Column<Definitions>().Resize(size), ...);
+    size_ = size;
+  }
+
+  void Clear() noexcept {
+    (Column<Definitions>().Clear(), ...);
+    size_ = 0;
+  }
+
+  template <typename Object>
+  void PushBack(Object&& object) {
+    if (size_ == capacity_) {
+      Reserve(capacity_ == 0 ? 8 : capacity_ * 2);
+    }
+
+    try {
+      (Column<Definitions>().EmplaceBack(ForwardField<Definitions>(std::forward<Object>(object))), ...);
+    } catch (...) {
+      // Roll back the columns that already received the new row so that all of them keep the same length
+      (TrimColumn<Definitions>(), ...);
+      throw;
+    }
+    ++size_;
+  }
+
+  void PopBack() noexcept {
+    (Column<Definitions>().PopBack(), ...);
+    --size_;
+  }
+
+  template <typename Object>
+  void Store(std::size_t index, Object&& object) {
+    ((Column<Definitions>()[index] = ForwardField<Definitions>(std::forward<Object>(object))), ...);
+  }
+
+  [[nodiscard]] T Load(std::size_t index) const
+    requires std::default_initializable<T>
+  {
+    T object{};
+    (Definitions::SymbolType::SetValue(object, Column<Definitions>()[index]), ...);
+    return object;
+  }
+
+  template <std::size_t I>
+  [[nodiscard]] auto& ColumnAt() noexcept {
+    return std::get<I>(columns_);
+  }
+
+  template <std::size_t I>
+  [[nodiscard]] const auto& ColumnAt() const noexcept {
+    return std::get<I>(columns_);
+  }
+
+private:
+  template <typename Definition>
+  static constexpr std::size_t kColumnIndex = [] {
+    constexpr std::array<bool, kColumnCount> matches = {std::same_as<Definition, Definitions>...};
+    return static_cast<std::size_t>(std::find(matches.begin(), matches.end(), true) - matches.begin());
+  }();
+
+  template <typename Definition>
+  [[nodiscard]] auto& Column() noexcept {
+    return std::get<kColumnIndex<Definition>>(columns_);
+  }
+
+  template <typename Definition>
+  [[nodiscard]] const auto& Column() const noexcept {
+    return std::get<kColumnIndex<Definition>>(columns_);
+  }
+
+  template <typename Definition>
+  void TrimColumn() noexcept {
+    if (Column<Definition>().Size() > size_) {
+      Column<Definition>().PopBack();
+    }
+  }
+
+  template <typename Definition, typename Object>
+  [[nodiscard]] static decltype(auto) ForwardField(Object&& object) noexcept {
+    if constexpr (std::is_lvalue_reference_v<Object>) {
+      return Definition::SymbolType::GetValue(object);
+    } else {
+      return std::move(Definition::SymbolType::GetValue(object));
+    }
+  }
+
+  std::tuple<ColumnBuffer<DefinitionValueType<Definitions>>...> columns_;
+  std::size_t size_ = 0;
+  std::size_t capacity_ = 0;
+};
+
+}  // namespace ctti::detail
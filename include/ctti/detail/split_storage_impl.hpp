@@ -0,0 +1,162 @@
+#pragma once
+
+#include <ctti/attributes.hpp>
+#include <ctti/detail/compile_time_string.hpp>
+#include <ctti/detail/meta.hpp>
+#include <ctti/detail/reflection_impl.hpp>
+#include <ctti/detail/soa_vector_impl.hpp>
+#include <ctti/reflection.hpp>
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace ctti::detail {
+
+template <typename Definition>
+struct IsHotDefinition : BoolType<Definition::SymbolType::template HasTag<hot_tag>()> {};
+
+// Data members are cold unless tagged hot, since hot loops usually touch a handful of fields
+template <typename Definition>
+struct IsColdDefinition : BoolType<!Definition::SymbolType::template HasTag<hot_tag>()> {};
+
+template <typename Definition>
+constexpr bool kHasConflictingTemperature =
+    Definition::SymbolType::template HasTag<hot_tag>() && Definition::SymbolType::template HasTag<cold_tag>();
+
+template <typename DefinitionList>
+struct SplitRecord;
+
+template <typename... Definitions>
+struct SplitRecord<TypeList<Definitions...>> {
+  using type = std::tuple<DefinitionValueType<Definitions>...>;
+
+  template <typename Object>
+  [[nodiscard]] static type Make(Object&& object) {
+    if constexpr (std::is_lvalue_reference_v<Object>) {
+      return type(Definitions::SymbolType::GetValue(object)...);
+    } else {
+      return type(std::move(Definitions::SymbolType::GetValue(object))...);
+    }
+  }
+
+  template <typename Object>
+  static void Scatter(const type& record, Object& object) {
+    [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+      (Definitions::SymbolType::SetValue(object, std::get<Is>(record)), ...);
+    }(std::index_sequence_for<Definitions...>{});
+  }
+};
+
+template <typename T>
+class SplitStorage {
+public:
+  using HotDefinitionsType = FilterType<IsHotDefinition, DataMemberDefinitionsOf<T>>;
+  using ColdDefinitionsType = FilterType<IsColdDefinition, DataMemberDefinitionsOf<T>>;
+  using HotRecordType = TypeOf<SplitRecord<HotDefinitionsType>>;
+  using ColdRecordType = TypeOf<SplitRecord<ColdDefinitionsType>>;
+
+  static_assert(![]<typename... Definitions>(TypeList<Definitions...>) {
+    return (kHasConflictingTemperature<Definitions> || ...);
+  }(DataMemberDefinitionsOf<T>{}), "a data member cannot be both ctti::hot and ctti::cold");
+
+  template <CompileTimeString Name>
+  static constexpr std::size_t kHotIndexOf = kDefinitionIndex<Name, HotDefinitionsType>;
+
+  template <CompileTimeString Name>
+  static constexpr std::size_t kColdIndexOf = kDefinitionIndex<Name, ColdDefinitionsType>;
+
+  template <CompileTimeString Name>
+  static constexpr bool kIsHot = kHotIndexOf<Name> < HotDefinitionsType::kSize;
+
+  template <CompileTimeString Name>
+  static constexpr bool kHasField = kIsHot<Name> || kColdIndexOf<Name> < ColdDefinitionsType::kSize;
+
+  template <CompileTimeString Name>
+    requires(kHasField<Name>)
+  using FieldValueType = std::conditional_t<kIsHot<Name>, std::tuple_element<kHotIndexOf<Name>, HotRecordType>,
+                                            std::tuple_element<kColdIndexOf<Name>, ColdRecordType>>::type;
+
+  [[nodiscard]] std::size_t Size() const noexcept { return hot_.Size(); }
+  [[nodiscard]] std::size_t Capacity() const noexcept { return std::min(hot_.Capacity(), cold_.Capacity()); }
+
+  void Reserve(std::size_t capacity) {
+    hot_.Reserve(capacity);
+    cold_.Reserve(capacity);
+  }
+
+  void Resize(std::size_t size) {
+    Reserve(size);
+    hot_.Resize(size);
+    cold_.Resize(size);
+  }
+
+  void Clear() noexcept {
+    hot_.Clear();
+    cold_.Clear();
+  }
+
+  template <typename Object>
+  void PushBack(Object&& object) {
+    if (hot_.Size() == hot_.Capacity()) {
+      Reserve(hot_.Capacity() == 0 ? 8 : hot_.Capacity() * 2);
+    }
+    hot_.EmplaceBack(SplitRecord<HotDefinitionsType>::Make(std::forward<Object>(object)));
+    try {
+      cold_.EmplaceBack(SplitRecord<ColdDefinitionsType>::Make(std::forward<Object>(object)));
+    } catch (...) {
+      // Keep both arrays the same length
+      hot_.PopBack();
+      throw;
+    }
+  }
+
+  void PopBack() noexcept {
+    hot_.PopBack();
+    cold_.PopBack();
+  }
+
+  template <typename Object>
+  void Store(std::size_t index, Object&& object) {
+    hot_[index] = SplitRecord<HotDefinitionsType>::Make(std::forward<Object>(object));
+    cold_[index] = SplitRecord<ColdDefinitionsType>::Make(std::forward<Object>(object));
+  }
+
+  [[nodiscard]] T Load(std::size_t index) const
+    requires std::default_initializable<T>
+  {
+    T object{};
+    SplitRecord<HotDefinitionsType>::Scatter(hot_[index], object);
+    SplitRecord<ColdDefinitionsType>::Scatter(cold_[index], object);
+    return object;
+  }
+
+  template <CompileTimeString Name>
+    requires(kHasField<Name>)
+  [[nodiscard]] auto& Field(std::size_t index) noexcept {
+    if constexpr (kIsHot<Name>) {
+      return std::get<kHotIndexOf<Name>>(hot_[index]);
+    } else {
+      return std::get<kColdIndexOf<Name>>(cold_[index]);
+    }
+  }
+
+  template <CompileTimeString Name>
+    requires(kHasField<Name>)
+  [[nodiscard]] const auto& Field(std::size_t index) const noexcept {
+    if constexpr (kIsHot<Name>) {
+      return std::get<kHotIndexOf<Name>>(hot_[index]);
+    } else {
+      return std::get<kColdIndexOf<Name>>(cold_[index]);
+    }
+  }
+
+private:
+  ColumnBuffer<HotRecordType> hot_;
+  ColumnBuffer<ColdRecordType> cold_;
+};
+
+}  // namespace ctti::detail
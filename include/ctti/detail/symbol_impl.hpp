@@ -36,11 +36,20 @@ template <typename AttributeList, typename Tag>
   }
 }
 
+// Proxies standing for one record of a container, such as split_storage<T>::reference, name the record type and give
+// access to each field through get<Name>()
+template <typename Proxy, auto Name>
+concept RecordProxyWith = requires(const Proxy& proxy) {
+  typename Proxy::record_type;
+  proxy.template get<Name>();
+};
+
 template <CompileTimeString Name, typename AttributeList = TypeList<>, auto... MemberPtrs>
 struct Symbol {
   using AttributesType = AttributeList;
   using OverloadSetType = MemberOverloadSet<MemberPtrs...>;
 
+  static constexpr auto kNameLiteral = Name;
   static constexpr std::string_view kName = Name.View();
   static constexpr HashType kHash = Fnv1aHash(kName);
   static constexpr bool kHasOverloads = sizeof...(MemberPtrs) > 0;
@@ -69,6 +78,17 @@ struct Symbol {
     return SymbolHasAttributeTag<AttributesType, Tag>();
   }
 
+  template <CompileTimeString Key>
+  [[nodiscard]] static constexpr bool HasKey() noexcept {
+    return AttributeListOfType<AttributesType>::template HasKey<Key>();
+  }
+
+  template <CompileTimeString Key>
+    requires(HasKey<Key>())
+  [[nodiscard]] static constexpr auto GetKeyValue() noexcept {
+    return AttributeListOfType<AttributesType>::template GetKeyValue<Key>();
+  }
+
   template <typename Signature>
   [[nodiscard]] static constexpr bool HasOverloadWithSignature() noexcept {
     if constexpr (kHasOverloads) {
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <ctti/detail/meta.hpp>
+#include <ctti/reflection.hpp>
+
+namespace ctti::detail {
+
+template <typename... Attributes>
+struct HasAllAttributes {
+  template <typename Definition>
+  struct Predicate : BoolType<(Definition::SymbolType::template HasAttribute<Attributes>() && ...)> {};
+};
+
+template <typename... Attributes>
+struct HasNoAttributes {
+  template <typename Definition>
+  struct Predicate : BoolType<!(Definition::SymbolType::template HasAttribute<Attributes>() || ...)> {};
+};
+
+// Filtering happens on the definition list, so symbols that do not match are never instantiated by the caller
+template <reflectable T, typename... Attributes>
+using DefinitionsWithType = FilterType<HasAllAttributes<Attributes...>::template Predicate,
+                                       typename ReflectionOf<T>::DefinitionsType>;
+
+template <reflectable T, typename... Attributes>
+using DefinitionsWithoutType = FilterType<HasNoAttributes<Attributes...>::template Predicate,
+                                          typename ReflectionOf<T>::DefinitionsType>;
+
+}  // namespace ctti::detail
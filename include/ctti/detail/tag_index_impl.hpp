@@ -0,0 +1,48 @@
+#pragma once
+
+#include <ctti/detail/meta.hpp>
+#include <ctti/detail/perfect_hash.hpp>
+#include <ctti/detail/symbol_impl.hpp>
+#include <ctti/reflection.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace ctti::detail {
+
+using TagMaskType = std::uint64_t;
+
+constexpr std::size_t kMaxTagCount = 64;
+
+// Bit I is set when the attribute list holds a tag_attribute of the I-th tag
+template <typename AttributeList, typename... Tags>
+[[nodiscard]] consteval TagMaskType TagMaskOf() noexcept {
+  TagMaskType mask = 0;
+  std::size_t bit = 0;
+  ((mask |= SymbolHasAttributeTag<AttributeList, Tags>() ? TagMaskType{1} << bit : 0, ++bit), ...);
+  return mask;
+}
+
+template <typename Query, typename... Tags>
+[[nodiscard]] consteval TagMaskType TagBit() noexcept {
+  TagMaskType mask = 0;
+  std::size_t bit = 0;
+  ((mask |= std::same_as<Query, Tags> ? TagMaskType{1} << bit : 0, ++bit), ...);
+  return mask;
+}
+
+template <typename DefinitionList, typename... Tags>
+struct SymbolTagMasks;
+
+template <typename... Definitions, typename... Tags>
+struct SymbolTagMasks<TypeList<Definitions...>, Tags...> {
+  static constexpr std::size_t kCount = sizeof...(Definitions);
+  static constexpr std::array<TagMaskType, kCount> kMasks = {
+      TagMaskOf<typename Definitions::SymbolType::AttributesType, Tags...>()...};
+  static constexpr std::array<std::string_view, kCount> kNames = {Definitions::kName...};
+  static constexpr PerfectHashIndex<kCount> kIndex{kNames};
+};
+
+}  // namespace ctti::detail
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <ctti/detail/member_traits.hpp>
 #include <ctti/detail/meta.hpp>
 #include <ctti/detail/symbol_impl.hpp>
 
@@ -63,6 +64,9 @@ constexpr void TieType<TypeList<Symbols...>, TypeList<Refs...>>::AssignMember(co
         if constexpr (std::invocable<decltype(member_ptr), const T&>) {
           std::get<Index>(refs_) = std::invoke(member_ptr, object);
         }
+      } else if constexpr (requires { requires MemberTraits<std::remove_cv_t<decltype(member_ptr)>>::kIsDataMember; }) {
+        // Aggregate fields are accessors rather than member pointers
+        std::get<Index>(refs_) = Symbol::get_value(object);
       }
     }
   }
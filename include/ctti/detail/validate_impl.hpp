@@ -0,0 +1,164 @@
+#pragma once
+
+#include <ctti/attributes.hpp>
+#include <ctti/detail/compile_time_string.hpp>
+#include <ctti/detail/meta.hpp>
+#include <ctti/detail/reflection_impl.hpp>
+#include <ctti/reflection.hpp>
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <ranges>
+#include <span>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+namespace ctti::detail {
+
+template <typename Attribute>
+struct IsRangeConstraint : FalseType {};
+
+template <auto Min, auto Max>
+struct IsRangeConstraint<range<Min, Max>> : TrueType {};
+
+template <typename Attribute>
+struct IsMaxLengthConstraint : FalseType {};
+
+template <std::size_t Length>
+struct IsMaxLengthConstraint<max_length<Length>> : TrueType {};
+
+template <typename Attribute>
+constexpr bool kIsConstraint = IsRangeConstraint<Attribute>::value || IsMaxLengthConstraint<Attribute>::value ||
+                                std::same_as<Attribute, non_empty>;
+
+template <typename Value>
+concept RangeCheckable = std::is_arithmetic_v<Value> && !std::same_as<Value, bool>;
+
+template <typename Value>
+concept SizeCheckable = std::ranges::sized_range<const Value>;
+
+// Integers are compared through std::cmp_* so that a negative bound against an unsigned member stays correct
+template <auto Bound, typename Value>
+[[nodiscard]] constexpr bool LessEqual(Value lhs) noexcept {
+  if constexpr (std::is_integral_v<Value> && std::is_integral_v<decltype(Bound)>) {
+    return std::cmp_less_equal(lhs, Bound);
+  } else {
+    return lhs <= Bound;
+  }
+}
+
+template <auto Bound, typename Value>
+[[nodiscard]] constexpr bool GreaterEqual(Value lhs) noexcept {
+  if constexpr (std::is_integral_v<Value> && std::is_integral_v<decltype(Bound)>) {
+    return std::cmp_greater_equal(lhs, Bound);
+  } else {
+    return lhs >= Bound;
+  }
+}
+
+// NaN fails every range, since both comparisons are false for it
+template <typename Constraint, typename Value>
+[[nodiscard]] constexpr bool Satisfies(const Value& value) noexcept {
+  if constexpr (IsRangeConstraint<Constraint>::value) {
+    static_assert(RangeCheckable<Value>, "ctti::range applies to arithmetic data members only");
+    return GreaterEqual<Constraint::min>(value) && LessEqual<Constraint::max>(value);
+  } else if constexpr (IsMaxLengthConstraint<Constraint>::value) {
+    static_assert(SizeCheckable<Value>, "ctti::max_length applies to strings and containers only");
+    return static_cast<std::size_t>(std::ranges::size(value)) <= Constraint::length;
+  } else {
+    static_assert(SizeCheckable<Value>, "ctti::non_empty applies to strings and containers only");
+    return std::ranges::size(value) != 0;
+  }
+}
+
+struct ValidationFailure {
+  std::string_view field;
+  std::string_view constraint;
+};
+
+template <typename T>
+[[nodiscard]] constexpr bool ValidateObject(const T& object, ValidationFailure& failure);
+
+template <typename Definition, typename T, typename... Attributes>
+[[nodiscard]] constexpr bool ValidateMember(const T& object, TypeList<Attributes...> /*attributes*/,
+                                            ValidationFailure& failure) {
+  const auto& value = Definition::SymbolType::GetValue(object);
+  const bool valid = ([&] {
+    if constexpr (kIsConstraint<Attributes>) {
+      if (!Satisfies<Attributes>(value)) {
+        failure = {Definition::kName, Attributes::name};
+        return false;
+      }
+    }
+    return true;
+  }() && ...);
+  if constexpr (reflectable<std::remove_cvref_t<decltype(value)>>) {
+    return valid && ValidateObject(value, failure);
+  } else {
+    return valid;
+  }
+}
+
+// Stops at the first data member that breaks a constraint, checking nested reflectable types depth first
+template <typename T>
+[[nodiscard]] constexpr bool ValidateObject(const T& object, ValidationFailure& failure) {
+  return []<typename... Definitions>(const T& obj, ValidationFailure& out, TypeList<Definitions...>) {
+    return (ValidateMember<Definitions>(obj, typename Definitions::AttributesType{}, out) && ...);
+  }(object, failure, DataMemberDefinitionsOf<T>{});
+}
+
+template <typename Definition>
+struct DefinitionNameOf;
+
+template <CompileTimeString Name, auto Ptr, typename... Attributes>
+struct DefinitionNameOf<SymbolDefinition<Name, Ptr, Attributes...>> {
+  static constexpr auto kValue = Name;
+};
+
+constexpr std::size_t kBitmapWordBits = 64;
+
+// Marks the rows of a column that break a range constraint. Each word of the bitmap is built from a fixed block of
+// rows with compares and shifts only, so the inner loop has no branches and vectorizes over contiguous columns.
+template <typename Constraint, typename Get>
+void MarkRangeFailures(std::size_t count, const Get& get, std::span<std::uint64_t> words) {
+  for (std::size_t word = 0; word * kBitmapWordBits < count; ++word) {
+    const std::size_t begin = word * kBitmapWordBits;
+    const std::size_t length = std::min(kBitmapWordBits, count - begin);
+    std::uint64_t bits = 0;
+    for (std::size_t bit = 0; bit < length; ++bit) {
+      const auto value = get(begin + bit);
+      const bool valid = GreaterEqual<Constraint::min>(value) & LessEqual<Constraint::max>(value);
+      bits |= static_cast<std::uint64_t>(!valid) << bit;
+    }
+    words[word] |= bits;
+  }
+}
+
+template <typename Constraint, typename Get>
+void MarkFailures(std::size_t count, const Get& get, std::span<std::uint64_t> words) {
+  if constexpr (IsRangeConstraint<Constraint>::value) {
+    MarkRangeFailures<Constraint>(count, get, words);
+  } else {
+    for (std::size_t row = 0; row < count; ++row) {
+      if (!Satisfies<Constraint>(get(row))) {
+        words[row / kBitmapWordBits] |= std::uint64_t{1} << (row % kBitmapWordBits);
+      }
+    }
+  }
+}
+
+// Runs every constraint of a column over all of its rows, one constraint at a time
+template <typename Get, typename... Attributes>
+void MarkColumnFailures([[maybe_unused]] std::size_t count, [[maybe_unused]] const Get& get,
+                        TypeList<Attributes...> /*attributes*/, [[maybe_unused]] std::span<std::uint64_t> words) {
+  ([&] {
+    if constexpr (kIsConstraint<Attributes>) {
+      MarkFailures<Attributes>(count, get, words);
+    }
+  }(), ...);
+}
+
+}  // namespace ctti::detail
@@ -0,0 +1,96 @@
+#pragma once
+
+#include <ctti/detail/layout_info_impl.hpp>
+#include <ctti/detail/meta.hpp>
+#include <ctti/detail/reflection_impl.hpp>
+#include <ctti/reflection.hpp>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+
+namespace ctti::detail {
+
+template <typename T>
+constexpr bool kIsSwappableScalar = std::is_arithmetic_v<T> || std::is_enum_v<T>;
+
+template <typename T>
+struct IsSwappable : BoolType<kIsSwappableScalar<T>> {};
+
+template <typename T, std::size_t N>
+struct IsSwappable<std::array<T, N>> : IsSwappable<T> {};
+
+// Values that can be loaded from bytes stored in Order, converting them to the native byte order if needed. C arrays
+// are excluded since they cannot be returned by value.
+template <typename T, std::endian Order>
+concept ViewableValue = std::is_trivially_copyable_v<T> && !std::is_array_v<T> &&
+                        (Order == std::endian::native || IsSwappable<std::remove_cv_t<T>>::value);
+
+template <typename DefinitionList, std::endian Order>
+struct ViewableMembers;
+
+template <typename T, std::endian Order>
+struct IsViewable : BoolType<ViewableValue<T, Order>> {};
+
+// Reflectable data members are viewed in place as well, so they need a standard layout all the way down
+template <reflectable T, std::endian Order>
+struct IsViewable<T, Order>
+    : BoolType<std::is_standard_layout_v<T> && ViewableMembers<DataMemberDefinitionsOf<T>, Order>::value> {};
+
+template <typename... Definitions, std::endian Order>
+struct ViewableMembers<TypeList<Definitions...>, Order>
+    : BoolType<(IsViewable<DefinitionValueType<Definitions>, Order>::value && ...)> {};
+
+template <typename T>
+[[nodiscard]] T ReverseBytes(T value) noexcept {
+  auto bytes = std::bit_cast<std::array<std::byte, sizeof(T)>>(value);
+  std::reverse(bytes.begin(), bytes.end());
+  return std::bit_cast<T>(bytes);
+}
+
+// Reverses the bytes of every scalar, recursing into arrays so that nested arrays keep their element order
+template <typename T>
+[[nodiscard]] T SwapByteOrder(T value) noexcept {
+  if constexpr (!kIsSwappableScalar<T>) {
+    for (auto& element : value) {
+      element = SwapByteOrder(element);
+    }
+    return value;
+  } else if constexpr (sizeof(T) > 1) {
+    return ReverseBytes(value);
+  } else {
+    return value;
+  }
+}
+
+// memcpy into a byte array and bit_cast out of it, so that unaligned data is never accessed through a T
+template <typename T, std::endian Order>
+[[nodiscard]] T LoadValue(const std::byte* data) noexcept {
+  std::array<std::byte, sizeof(T)> bytes;
+  std::memcpy(bytes.data(), data, sizeof(T));
+  auto value = std::bit_cast<T>(bytes);
+  if constexpr (Order != std::endian::native) {
+    value = SwapByteOrder(value);
+  }
+  return value;
+}
+
+template <typename T, typename DefinitionList>
+struct ViewOffsets;
+
+// Byte offset of every data member, computed once per type from an unconstructed probe object
+template <typename T, typename... Definitions>
+struct ViewOffsets<T, TypeList<Definitions...>> {
+  [[nodiscard]] static const std::array<std::size_t, sizeof...(Definitions)>& Get() noexcept {
+    static const std::array<std::size_t, sizeof...(Definitions)> offsets = {DataMemberOffset<Definitions, T>()...};
+    return offsets;
+  }
+};
+
+template <reflectable T>
+using ViewOffsetsOf = ViewOffsets<T, DataMemberDefinitionsOf<T>>;
+
+}  // namespace ctti::detail
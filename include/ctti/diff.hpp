@@ -0,0 +1,192 @@
+#pragma once
+
+#include <ctti/detail/compare_impl.hpp>
+#include <ctti/detail/compile_time_string.hpp>
+#include <ctti/detail/diff_impl.hpp>
+#include <ctti/reflection.hpp>
+#include <ctti/serialize.hpp>
+
+#include <cstddef>
+#include <tuple>
+#include <utility>
+
+namespace ctti {
+
+/**
+ * @brief The changed data members of an object, as produced by diff and consumed by apply_patch.
+ * @details Holds a bitmask with one bit per reflected data member, sized at compile time to the smallest unsigned
+ * integer that fits, together with a plain value slot per member. The mask is the only record of which slots hold a
+ * change, so the data members of T must be default constructible.
+ * @tparam T The reflectable type the patch applies to.
+ */
+template <reflectable T>
+class patch {
+private:
+  using definitions = detail::DataMemberDefinitionsOf<T>;
+
+  template <detail::CompileTimeString Name>
+  static constexpr std::size_t field_index = detail::kDefinitionIndex<Name, definitions>;
+
+public:
+  /// Number of data members tracked by the patch.
+  static constexpr std::size_t field_count = definitions::kSize;
+
+  /// Bitmask type with one bit per data member, in reflection order.
+  using mask_type = detail::FieldMaskType<field_count>;
+
+  /**
+   * @brief Gets the bitmask of changed data members.
+   * @return The bitmask, where bit I is set if the I-th data member changed.
+   */
+  [[nodiscard]] constexpr const mask_type& mask() const noexcept { return mask_; }
+
+  /**
+   * @brief Checks if the patch changes no data member.
+   * @return True if no data member changed, false otherwise.
+   */
+  [[nodiscard]] constexpr bool empty() const noexcept { return detail::MaskCount(mask_) == 0; }
+
+  /**
+   * @brief Gets the number of changed data members.
+   * @return The number of bits set in the mask.
+   */
+  [[nodiscard]] constexpr std::size_t changed_count() const noexcept { return detail::MaskCount(mask_); }
+
+  /**
+   * @brief Checks if the data member with the given name changed.
+   * @tparam Name The compile-time string representing the name of the data member.
+   * @return True if the data member changed, false otherwise.
+   */
+  template <detail::CompileTimeString Name>
+    requires(field_index<Name> < field_count)
+  [[nodiscard]] constexpr bool changed() const noexcept {
+    return detail::MaskTest(mask_, field_index<Name>);
+  }
+
+  /**
+   * @brief Gets the new value of the data member with the given name.
+   * @tparam Name The compile-time string representing the name of the data member.
+   * @return A pointer to the new value, or nullptr if the data member did not change.
+   */
+  template <detail::CompileTimeString Name>
+    requires(field_index<Name> < field_count)
+  [[nodiscard]] constexpr const auto* value() const noexcept {
+    using value_type = std::tuple_element_t<field_index<Name>, detail::PatchValuesType<T>>;
+    return changed<Name>() ? &std::get<field_index<Name>>(values_) : static_cast<const value_type*>(nullptr);
+  }
+
+  /**
+   * @brief Records a new value for the data member with the given name.
+   * @tparam Name The compile-time string representing the name of the data member.
+   * @tparam Value The type of the value.
+   * @param value The new value.
+   */
+  template <detail::CompileTimeString Name, typename Value>
+    requires(field_index<Name> < field_count)
+  constexpr void set(Value&& value) {
+    std::get<field_index<Name>>(values_) = std::forward<Value>(value);
+    detail::MaskSet(mask_, field_index<Name>);
+  }
+
+  /**
+   * @brief Removes every recorded change.
+   * @details Only the mask is cleared, the values left in the patch are overwritten by the next changes.
+   */
+  constexpr void clear() noexcept { mask_ = mask_type{}; }
+
+private:
+  friend struct detail::PatchAccess;
+
+  mask_type mask_ = {};
+  detail::PatchValuesType<T> values_;
+};
+
+/**
+ * @brief Computes the data members that differ between two versions of an object.
+ * @details Data members are compared with the same rules as reflected_equal, and only the new values of the members
+ * that differ are stored.
+ * @tparam T The reflectable type of the objects.
+ * @param before The old version of the object.
+ * @param after The new version of the object.
+ * @return A patch that turns before into after.
+ *
+ * @example
+ * @code
+ * auto changes = ctti::diff(previous, current);
+ * if (!changes.empty()) {
+ *   ctti::apply_patch(replica, changes);
+ * }
+ * @endcode
+ */
+template <reflectable T>
+[[nodiscard]] constexpr patch<T> diff(const T& before, const T& after) {
+  return detail::Diff<patch<T>>(before, after);
+}
+
+/**
+ * @brief Computes the data members that differ between two versions of an object, moving the new values.
+ * @tparam T The reflectable type of the objects.
+ * @param before The old version of the object.
+ * @param after The new version of the object, whose changed data members are moved into the patch.
+ * @return A patch that turns before into after.
+ */
+template <reflectable T>
+[[nodiscard]] constexpr patch<T> diff(const T& before, T&& after) {
+  return detail::Diff<patch<T>>(before, std::move(after));
+}
+
+/**
+ * @brief Assigns the changed data members recorded in a patch to an object.
+ * @tparam T The reflectable type of the object.
+ * @param object The object to update.
+ * @param changes The patch to apply.
+ */
+template <reflectable T>
+constexpr void apply_patch(T& object, const patch<T>& changes) {
+  detail::ApplyPatch(object, changes);
+}
+
+/**
+ * @brief Moves the changed data members recorded in a patch into an object.
+ * @tparam T The reflectable type of the object.
+ * @param object The object to update.
+ * @param changes The patch to apply, whose values are moved from.
+ */
+template <reflectable T>
+constexpr void apply_patch(T& object, patch<T>&& changes) {
+  detail::ApplyPatch(object, std::move(changes));
+}
+
+/**
+ * @brief Serializes only the changed data members of a patch.
+ * @details Writes the mask, then the new value of every data member whose bit is set, in reflection order and with
+ * the same encoding as serialize at schema_version<T>. Unchanged members take no bytes at all.
+ * @tparam T The serializable type the patch applies to.
+ * @param changes The patch to serialize.
+ * @param writer The writer to append to.
+ *
+ * @example
+ * @code
+ * ctti::byte_writer writer;
+ * ctti::serialize_patch(ctti::diff(previous, current), writer);
+ * send(writer.bytes());
+ * @endcode
+ */
+template <serializable T>
+void serialize_patch(const patch<T>& changes, byte_writer& writer) {
+  detail::WritePatch<T>(writer, changes);
+}
+
+/**
+ * @brief Deserializes a patch written by serialize_patch.
+ * @tparam T The serializable type the patch applies to.
+ * @param reader The reader to consume.
+ * @param changes The patch to read into, whose previous changes are replaced.
+ * @return True on success, false if the mask has bits past the last data member or the payload is truncated.
+ */
+template <serializable T>
+[[nodiscard]] bool deserialize_patch(byte_reader& reader, patch<T>& changes) {
+  return detail::ReadPatch<T>(reader, changes);
+}
+
+}  // namespace ctti
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <cstddef>
+
+namespace ctti {
+
+/**
+ * @brief Controls how bulk operations split their work across threads.
+ * @details Work is divided into chunks of about chunk_bytes bytes each, and the chunks are processed by worker
+ * threads. Results are identical to sequential processing, whatever the number of threads.
+ */
+struct exec_policy {
+  /// Number of threads to use, including the calling thread. 0 uses std::thread::hardware_concurrency().
+  std::size_t thread_count = 0;
+
+  /// Approximate number of bytes processed per chunk. 0 picks a size that fits the per-core cache.
+  std::size_t chunk_bytes = 0;
+};
+
+/// Runs bulk operations on the calling thread only.
+inline constexpr exec_policy seq{.thread_count = 1};
+
+/// Runs bulk operations on every hardware thread.
+inline constexpr exec_policy par{};
+
+}  // namespace ctti
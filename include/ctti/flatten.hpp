@@ -0,0 +1,167 @@
+#pragma once
+
+#include <ctti/detail/compile_time_string.hpp>
+#include <ctti/detail/flatten_impl.hpp>
+#include <ctti/reflection.hpp>
+
+#include <array>
+#include <cstddef>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+namespace ctti {
+
+/**
+ * @brief The leaves of a reflectable type with its nested reflectable data members expanded.
+ * @details A data member whose type is reflectable is replaced by the data members of that type, recursively, so
+ * that every leaf is addressed by a single dotted path such as "pose.position.x". Paths are looked up at runtime
+ * through a perfect hash built at compile time.
+ * @tparam T The reflectable type to flatten.
+ *
+ * @example
+ * @code
+ * using flat = ctti::flattened<Robot>;
+ *
+ * static_assert(flat::has_path<"pose.position.x">());
+ * double& x = flat::get<"pose.position.x">(robot);
+ *
+ * std::size_t index = flat::find("pose.position.x");
+ * std::size_t offset = flat::offsets()[index];
+ * @endcode
+ */
+template <reflectable T>
+struct flattened {
+private:
+  using internal_leaves = detail::FlatLeavesOf<T>;
+  using leaf_paths = detail::LeafPathsType<T>;
+
+  template <detail::CompileTimeString Path>
+  static constexpr std::size_t path_index = [] {
+    for (std::size_t i = 0; i < internal_leaves::kCount; ++i) {
+      if (internal_leaves::kNames[i] == Path.View()) {
+        return i;
+      }
+    }
+    return internal_leaves::kCount;
+  }();
+
+public:
+  /// Number of leaves.
+  static constexpr std::size_t leaf_count = internal_leaves::kCount;
+
+  /// Dotted paths of all leaves, in reflection order.
+  static constexpr std::array<std::string_view, leaf_count> paths = internal_leaves::kNames;
+
+  /**
+   * @brief Checks if a leaf with the given path exists.
+   * @tparam Path The compile-time string representing the dotted path.
+   * @return True if the leaf exists, false otherwise.
+   */
+  template <detail::CompileTimeString Path>
+  [[nodiscard]] static constexpr bool has_path() noexcept {
+    return path_index<Path> < leaf_count;
+  }
+
+  /**
+   * @brief The type of the leaf with the given path.
+   * @tparam Path The compile-time string representing the dotted path.
+   */
+  template <detail::CompileTimeString Path>
+    requires(has_path<Path>())
+  using leaf_type = std::remove_cv_t<detail::PathValueType<T, typename leaf_paths::template At<path_index<Path>>>>;
+
+  /**
+   * @brief Gets a reference to the leaf with the given path.
+   * @tparam Path The compile-time string representing the dotted path.
+   * @tparam Object The type of the object, T or const T.
+   * @param object The object to access.
+   * @return A reference to the leaf, const if the object is const.
+   */
+  template <detail::CompileTimeString Path, typename Object>
+    requires(has_path<Path>() && std::same_as<std::remove_const_t<Object>, T>)
+  [[nodiscard]] static constexpr auto& get(Object& object) noexcept {
+    return detail::PathAccess<typename leaf_paths::template At<path_index<Path>>>::Get(object);
+  }
+
+  /**
+   * @brief Finds the index of the leaf with the given path at runtime.
+   * @param path The dotted path.
+   * @return The index of the leaf in paths, or leaf_count if there is no such leaf.
+   */
+  [[nodiscard]] static constexpr std::size_t find(std::string_view path) noexcept {
+    return internal_leaves::kIndex.Find(path);
+  }
+
+  /**
+   * @brief Gets the byte offset of every leaf from the start of T.
+   * @details The offsets are computed once, on first use, from member addresses.
+   * @return The offsets, in the same order as paths.
+   */
+  [[nodiscard]] static const std::array<std::size_t, leaf_count>& offsets() noexcept
+    requires std::is_standard_layout_v<T>
+  {
+    return internal_leaves::Offsets();
+  }
+};
+
+/**
+ * @brief Gets a read-only pointer to the leaf with the given dotted path, looked up at runtime.
+ * @tparam Value The expected type of the leaf.
+ * @tparam T The reflectable type of the object.
+ * @param object The object to access.
+ * @param path The dotted path of the leaf.
+ * @return A pointer to the leaf, or nullptr if there is no such leaf or its type is not Value.
+ */
+template <typename Value, reflectable T>
+[[nodiscard]] const Value* get_by_path(const T& object, std::string_view path) noexcept {
+  using leaves = detail::FlatLeavesOf<T>;
+  const std::size_t index = leaves::kIndex.Find(path);
+  if (index == leaves::kCount || !leaves::template kHolds<Value>[index]) {
+    return nullptr;
+  }
+  return static_cast<const Value*>(leaves::kAccessors[index](object));
+}
+
+/**
+ * @brief Gets a pointer to the leaf with the given dotted path, looked up at runtime.
+ * @tparam Value The expected type of the leaf.
+ * @tparam T The reflectable type of the object.
+ * @param object The object to access.
+ * @param path The dotted path of the leaf.
+ * @return A pointer to the leaf, or nullptr if there is no such leaf or its type is not Value.
+ *
+ * @example
+ * @code
+ * if (double* x = ctti::get_by_path<double>(robot, "pose.position.x")) {
+ *   *x += 1.0;
+ * }
+ * @endcode
+ */
+template <typename Value, reflectable T>
+[[nodiscard]] Value* get_by_path(T& object, std::string_view path) noexcept {
+  return const_cast<Value*>(get_by_path<Value>(std::as_const(object), path));
+}
+
+/**
+ * @brief Calls a function with a reference to the leaf with the given dotted path, looked up at runtime.
+ * @tparam Object The reflectable type of the object, possibly const.
+ * @tparam F The type of the function, which must accept every leaf type.
+ * @param object The object to access.
+ * @param path The dotted path of the leaf.
+ * @param func The function to call.
+ * @return True if the leaf exists and the function was called, false otherwise.
+ */
+template <typename Object, typename F>
+  requires reflectable<std::remove_const_t<Object>>
+bool visit_path(Object& object, std::string_view path, F&& func) {
+  using leaves = detail::FlatLeavesOf<std::remove_const_t<Object>>;
+  const std::size_t index = leaves::kIndex.Find(path);
+  if (index == leaves::kCount) {
+    return false;
+  }
+  leaves::template kVisitors<Object, std::remove_reference_t<F>>[index](object, func);
+  return true;
+}
+
+}  // namespace ctti
@@ -0,0 +1,125 @@
+#pragma once
+
+#include <ctti/detail/compile_time_string.hpp>
+#include <ctti/detail/layout_info_impl.hpp>
+#include <ctti/detail/meta.hpp>
+#include <ctti/reflection.hpp>
+
+#include <array>
+#include <cstddef>
+#include <string_view>
+#include <type_traits>
+
+namespace ctti {
+
+/**
+ * @brief The placement of a single data member inside its enclosing type.
+ */
+struct field_layout {
+  std::string_view name;
+  std::size_t offset = 0;
+  std::size_t size = 0;
+  std::size_t alignment = 0;
+};
+
+/**
+ * @brief Layout analysis of a reflectable standard-layout type.
+ * @details Sizes, alignments, padding and the suggested field order are computed at compile time from the reflected
+ * data members. Offsets are read from member addresses, so they are only available at runtime. The padding figures
+ * assume that every data member of T is reflected; unreflected members are counted as padding. Reflecting the same
+ * data member under several names is rejected at compile time, since the padding figures would be meaningless.
+ * @tparam T The reflectable type to analyze.
+ *
+ * @example
+ * @code
+ * using layout = ctti::layout_info<Packet>;
+ *
+ * static_assert(ctti::padding_within_budget<Packet, 4>, "Packet wastes too much memory");
+ *
+ * for (std::string_view name : layout::suggested_order) {
+ *   std::cout << name << '\n';
+ * }
+ * @endcode
+ */
+template <reflectable T>
+  requires std::is_standard_layout_v<T>
+struct layout_info {
+private:
+  using definitions = detail::DataMemberDefinitionsOf<T>;
+
+  static constexpr auto shapes = detail::FieldShapes<definitions>::kValue;
+  static constexpr auto sorted_shapes = detail::SortByAlignment(shapes);
+
+public:
+  /// Number of reflected data members.
+  static constexpr std::size_t field_count = definitions::kSize;
+
+  /// Size of T in bytes.
+  static constexpr std::size_t size = sizeof(T);
+
+  /// Alignment of T in bytes.
+  static constexpr std::size_t alignment = alignof(T);
+
+  /// Sum of the sizes of the reflected data members.
+  static constexpr std::size_t data_size = detail::DataMembersSize<definitions>::value;
+
+  static_assert(data_size <= size, "ctti::layout_info requires every data member to be reflected under one name");
+
+  /// Bytes of T that are not occupied by a reflected data member.
+  static constexpr std::size_t padding_bytes = size - data_size;
+
+  /// Names of the reflected data members in the order that minimizes padding.
+  static constexpr std::array<std::string_view, field_count> suggested_order = [] {
+    std::array<std::string_view, field_count> names = {};
+    for (std::size_t i = 0; i < field_count; ++i) {
+      names[i] = sorted_shapes[i].name;
+    }
+    return names;
+  }();
+
+  /// Size T would have with its data members declared in suggested_order.
+  static constexpr std::size_t optimal_size = detail::LayoutSize(sorted_shapes, alignment);
+
+  /// Bytes saved per object by declaring the data members in suggested_order.
+  static constexpr std::size_t reorder_savings = size > optimal_size ? size - optimal_size : 0;
+
+  /**
+   * @brief Gets the offset of the data member with the given name.
+   * @tparam Name The compile-time string representing the name of the data member.
+   * @return The offset of the data member in bytes from the start of T.
+   */
+  template <detail::CompileTimeString Name>
+    requires(detail::kDefinitionIndex<Name, definitions> < field_count)
+  [[nodiscard]] static std::size_t offset_of() noexcept {
+    using definition = typename definitions::template At<detail::kDefinitionIndex<Name, definitions>>;
+    return detail::DataMemberOffset<definition, T>();
+  }
+
+  /**
+   * @brief Gets the layout of every reflected data member.
+   * @return The name, offset, size and alignment of each data member, in reflection order.
+   */
+  [[nodiscard]] static std::array<field_layout, field_count> fields() noexcept {
+    return []<typename... Definitions>(detail::TypeList<Definitions...>) {
+      return std::array<field_layout, field_count>{
+          field_layout{Definitions::kName, detail::DataMemberOffset<Definitions, T>(),
+                       sizeof(detail::DefinitionValueType<Definitions>),
+                       alignof(detail::DefinitionValueType<Definitions>)}...};
+    }(definitions{});
+  }
+};
+
+/**
+ * @brief Checks at compile time that a type does not waste more than a given number of bytes on padding.
+ * @tparam T The reflectable type to check.
+ * @tparam Budget The maximum number of padding bytes allowed.
+ *
+ * @example
+ * @code
+ * static_assert(ctti::padding_within_budget<Packet, 0>, "Packet must not contain padding");
+ * @endcode
+ */
+template <reflectable T, std::size_t Budget>
+constexpr bool padding_within_budget = layout_info<T>::padding_bytes <= Budget;
+
+}  // namespace ctti
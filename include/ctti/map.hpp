@@ -1,8 +1,17 @@
 #pragma once
 
+#include <ctti/detail/execution_impl.hpp>
 #include <ctti/detail/map_impl.hpp>
+#include <ctti/execution.hpp>
+#include <ctti/reflection.hpp>
 
+#include <algorithm>
+#include <array>
 #include <concepts>
+#include <cstddef>
+#include <span>
+#include <string_view>
+#include <type_traits>
 #include <utility>
 
 namespace ctti {
@@ -55,6 +64,126 @@ void map(const Source& source, Sink& sink, const Mappings&... mappings) noexcept
   detail::Map(source, sink, mappings...);
 }
 
+/**
+ * @brief Maps data from a source object that is about to expire to a sink object using a provided mapping function.
+ * @details The function receives the source as an rvalue, so it can move fields out of it.
+ * @tparam SourceSymbol A unique symbol representing the source type.
+ * @tparam SinkSymbol A unique symbol representing the sink type.
+ * @tparam Source The type of the source object.
+ * @tparam Sink The type of the sink object.
+ * @tparam Function The type of the mapping function.
+ * @param source The source object to map data from.
+ * @param sink The sink object to map data to.
+ * @param function The mapping function that defines how to map data from the source to the sink.
+ */
+template <auto SourceSymbol, auto SinkSymbol, typename Source, typename Sink, typename Function>
+  requires(!std::is_lvalue_reference_v<Source> &&
+           std::invocable<const Function&, Source&&, decltype(SourceSymbol), Sink&, decltype(SinkSymbol)>)
+void map(Source&& source, Sink& sink, const Function& function) noexcept(
+    noexcept(detail::Map<decltype(SourceSymbol), decltype(SinkSymbol)>(std::move(source), sink, function))) {
+  detail::Map<decltype(SourceSymbol), decltype(SinkSymbol)>(std::move(source), sink, function);
+}
+
+/**
+ * @brief Maps data from a source object that is about to expire to a sink object, moving the field.
+ * @details Heavy fields such as strings and vectors are handed over without allocating.
+ * @tparam SourceSymbol A unique symbol representing the source type.
+ * @tparam SinkSymbol A unique symbol representing the sink type.
+ * @tparam Source The type of the source object.
+ * @tparam Sink The type of the sink object.
+ * @param source The source object to move data from.
+ * @param sink The sink object to map data to.
+ */
+template <auto SourceSymbol, auto SinkSymbol, typename Source, typename Sink>
+  requires(!std::is_lvalue_reference_v<Source>)
+void map(Source&& source, Sink& sink) noexcept {
+  detail::Map<decltype(SourceSymbol), decltype(SinkSymbol)>(std::move(source), sink);
+}
+
+/**
+ * @brief Maps data from a source object that is about to expire to a sink object using multiple mapping definitions.
+ * @details Every mapping receives the source as an rvalue, and default mappings move their field. Each field of the
+ * source must be moved by at most one mapping.
+ * @tparam Source The type of the source object.
+ * @tparam Sink The type of the sink object.
+ * @tparam Mappings The types of the mapping definitions.
+ * @param source The source object to move data from.
+ * @param sink The sink object to map data to.
+ * @param mappings The mapping definitions that define how to map data from the source to the sink.
+ *
+ * @example
+ * @code
+ * ctti::map(std::move(stage_output), next_stage_input, payload_mapping, header_mapping);
+ * @endcode
+ */
+template <typename Source, typename Sink, typename... Mappings>
+  requires(!std::is_lvalue_reference_v<Source>)
+void map(Source&& source, Sink& sink, const Mappings&... mappings) noexcept {
+  detail::Map(std::move(source), sink, mappings...);
+}
+
+/**
+ * @brief Maps a batch of source objects to sink objects, one mapping at a time over the whole batch.
+ * @details Default mappings between data members of the same trivially copyable type are picked out at compile time
+ * and copied as bytes. The ones that sit next to each other without a gap in both layouts are fused into a single
+ * memcpy per object, and into a single memcpy for the whole batch when they cover every byte of both types. The
+ * member offsets are probed once per combination of types and mappings. Every other mapping then runs in its own loop
+ * over the batch. Byte copies happen before the other mappings, so mappings should not write the same sink field.
+ * @tparam Source The type of the source objects.
+ * @tparam Sink The type of the sink objects.
+ * @tparam Mappings The types of the mapping definitions.
+ * @param source The source objects to map data from.
+ * @param sink The sink objects to map data to. The first min(source.size(), sink.size()) objects are mapped.
+ * @param mappings The mapping definitions that define how to map data from the source to the sink.
+ *
+ * @example
+ * @code
+ * ctti::map_range(std::span<const Tick>(ticks), std::span<Row>(rows), ctti::make_mapping<tick_price, row_price>(),
+ *                 ctti::make_mapping<tick_size, row_size>());
+ * @endcode
+ */
+template <typename Source, typename Sink, typename... Mappings>
+  requires(std::invocable<const Mappings&, const Source&, Sink&> && ...)
+void map_range(std::span<const Source> source, std::span<Sink> sink, const Mappings&... mappings) {
+  const std::size_t count = std::min(source.size(), sink.size());
+  detail::RangeMappingPlan<Source, Sink, Mappings...>::Apply(source.first(count), sink.first(count), mappings...);
+}
+
+/**
+ * @brief Maps a batch of source objects to sink objects, splitting the work across threads.
+ * @details The objects are split into chunks of consecutive indices, holding about policy.chunk_bytes bytes of source
+ * and sink objects each, and every chunk is mapped as by the sequential overload. Each sink object is only written by
+ * the chunk that holds its index, so the result is the same as mapping the batch on a single thread. Mappings are
+ * called concurrently and must not modify shared state without synchronization.
+ * @tparam Source The type of the source objects.
+ * @tparam Sink The type of the sink objects.
+ * @tparam Mappings The types of the mapping definitions.
+ * @param policy How to split the work across threads.
+ * @param source The source objects to map data from.
+ * @param sink The sink objects to map data to. The first min(source.size(), sink.size()) objects are mapped.
+ * @param mappings The mapping definitions that define how to map data from the source to the sink.
+ *
+ * @example
+ * @code
+ * ctti::map_range(ctti::par, std::span<const Tick>(ticks), std::span<Row>(rows),
+ *                 ctti::make_mapping<tick_price, row_price>(), ctti::make_mapping<tick_size, row_size>());
+ * @endcode
+ */
+template <typename Source, typename Sink, typename... Mappings>
+  requires(std::invocable<const Mappings&, const Source&, Sink&> && ...)
+void map_range(const exec_policy& policy, std::span<const Source> source, std::span<Sink> sink,
+               const Mappings&... mappings) {
+  using plan = detail::RangeMappingPlan<Source, Sink, Mappings...>;
+  const std::size_t count = std::min(source.size(), sink.size());
+  const std::size_t chunk_length = detail::ChunkLength(policy, sizeof(Source) + sizeof(Sink));
+  const std::size_t chunk_count = (count + chunk_length - 1) / chunk_length;
+  detail::ParallelFor(chunk_count, policy, [&](std::size_t chunk) {
+    const std::size_t offset = chunk * chunk_length;
+    const std::size_t length = std::min(chunk_length, count - offset);
+    plan::Apply(source.subspan(offset, length), sink.subspan(offset, length), mappings...);
+  });
+}
+
 /**
  * @brief Creates a mapping object that defines how to map data between two types using a provided function.
  * @tparam SourceSymbol A unique symbol representing the source type.
@@ -82,4 +211,53 @@ template <auto SourceSymbol, auto SinkSymbol>
 template <auto SourceSymbol, auto SinkSymbol, typename Function = default_symbol_mapping_function>
 using symbol_mapping = detail::SymbolMapping<decltype(SourceSymbol), decltype(SinkSymbol), Function>;
 
+/**
+ * @brief The compile-time join of the data members of two reflectable types, used by auto_map.
+ * @details A source data member matches the sink data member with the same name and the same value type, provided
+ * the sink one is assignable. The lists of data members left out on either side make it possible to check at compile
+ * time that a mapping covers what it should.
+ * @tparam Source The reflectable type to map from.
+ * @tparam Sink The reflectable type to map to.
+ *
+ * @example
+ * @code
+ * static_assert(ctti::auto_mapping<OrderDto, Order>::unmatched_sink.empty(), "OrderDto must fill every field");
+ * @endcode
+ */
+template <reflectable Source, reflectable Sink>
+struct auto_mapping {
+private:
+  using internal_mapping = detail::AutoMapping<Source, Sink>;
+
+public:
+  /// Names of the matched data members, in source reflection order.
+  static constexpr const auto& matched = internal_mapping::kMatchedNames;
+
+  /// Names of the source data members without a match in Sink.
+  static constexpr const auto& unmatched_source = internal_mapping::kUnmatchedSource;
+
+  /// Names of the sink data members without a match in Source, which auto_map leaves unchanged.
+  static constexpr const auto& unmatched_sink = internal_mapping::kUnmatchedSink;
+};
+
+/**
+ * @brief Maps the data members of a source object to the data members of a sink object with the same name and type.
+ * @details The pairs are found at compile time, so the mapping compiles down to one assignment per matched pair.
+ * Data members of the sink without a match are left unchanged.
+ * @tparam Source The reflectable type of the source object.
+ * @tparam Sink The reflectable type of the sink object.
+ * @param source The source object to map data from.
+ * @param sink The sink object to map data to.
+ *
+ * @example
+ * @code
+ * Order order;
+ * ctti::auto_map(dto, order);
+ * @endcode
+ */
+template <reflectable Source, reflectable Sink>
+constexpr void auto_map(const Source& source, Sink& sink) noexcept(detail::AutoMapping<Source, Sink>::kNothrow) {
+  detail::AutoMapping<Source, Sink>::Map(source, sink);
+}
+
 }  // namespace ctti
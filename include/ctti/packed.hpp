@@ -0,0 +1,90 @@
+#pragma once
+
+#include <ctti/attributes.hpp>
+#include <ctti/detail/packed_impl.hpp>
+#include <ctti/reflection.hpp>
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+
+namespace ctti {
+
+/**
+ * @brief Concept that checks if a reflectable type can be bit-packed by ctti::packed.
+ * @details Every data member must be an integer, a bool, an enum, a float or a double.
+ * @tparam T The type to check.
+ */
+template <typename T>
+concept packable = reflectable<T> && detail::PackedLayoutOf<T>::kPackable;
+
+/**
+ * @brief Packs the data members of a type back to back into 64-bit words.
+ * @details Every data member takes the number of bits given by its bits<N> attribute, or its full width without one
+ * (a single bit for bool). Fields are laid out in reflection order and may straddle two words, so the words hold no
+ * gaps. The shifts and masks of every field are computed at compile time. Signed integers and enums with a signed
+ * underlying type are sign-extended when unpacked. Values that do not fit their width are truncated, which fits()
+ * detects.
+ * @tparam T The packable type.
+ *
+ * @example
+ * @code
+ * const auto words = ctti::packed<Telemetry>::pack(sample);  // std::array<std::uint64_t, 2>
+ * Telemetry restored = ctti::packed<Telemetry>::unpack(words);
+ * @endcode
+ */
+template <packable T>
+struct packed {
+private:
+  using internal_layout = detail::PackedLayoutOf<T>;
+
+public:
+  /// Number of bits used by the packed fields.
+  static constexpr std::size_t bit_count = internal_layout::kBitCount;
+
+  /// Number of 64-bit words the packed fields take.
+  static constexpr std::size_t word_count = internal_layout::kWordCount;
+
+  using words_type = std::array<std::uint64_t, word_count>;
+
+  /**
+   * @brief Packs the data members of an object.
+   * @param object The object to pack.
+   * @return The packed words, with unused high bits of the last word cleared.
+   */
+  [[nodiscard]] static constexpr words_type pack(const T& object) noexcept {
+    words_type words = {};
+    internal_layout::Pack(object, words);
+    return words;
+  }
+
+  /**
+   * @brief Unpacks words into the data members of an existing object.
+   * @param words The packed words.
+   * @param object The object to assign the data members of.
+   */
+  static constexpr void unpack(const words_type& words, T& object) noexcept { internal_layout::Unpack(words, object); }
+
+  /**
+   * @brief Unpacks words into a new object.
+   * @param words The packed words.
+   * @return A default-initialized T with every reflected data member set from the words.
+   */
+  [[nodiscard]] static constexpr T unpack(const words_type& words) noexcept
+    requires std::default_initializable<T>
+  {
+    T object{};
+    internal_layout::Unpack(words, object);
+    return object;
+  }
+
+  /**
+   * @brief Checks if every data member of an object fits its packed width.
+   * @param object The object to check.
+   * @return True if unpacking the packed object gives back equal data members, false otherwise.
+   */
+  [[nodiscard]] static constexpr bool fits(const T& object) noexcept { return internal_layout::Fits(object); }
+};
+
+}  // namespace ctti
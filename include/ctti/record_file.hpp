@@ -0,0 +1,350 @@
+#pragma once
+
+#include <ctti/detail/compile_time_string.hpp>
+#include <ctti/detail/record_file_impl.hpp>
+#include <ctti/reflection.hpp>
+#include <ctti/schema_hash.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <ostream>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace ctti {
+
+/**
+ * @brief Concept that checks if a reflectable type can be stored in a record file.
+ * @details Every leaf of T, with nested reflectable data members flattened, must be trivially copyable.
+ * @tparam T The type to check.
+ */
+template <typename T>
+concept record_storable = reflectable<T> && detail::RecordColumnsOf<T>::kStorable;
+
+/**
+ * @brief Streams records into a columnar record file.
+ * @details Records are buffered and written in chunks. A chunk holds one contiguous block per leaf of T, aligned to
+ * 64 bytes from the start of the file. Closing the writer appends a directory of the columns and chunks and a footer
+ * that locates it, so the file is written front to back without seeking. The header stores schema_hash<T>(). The
+ * stream is checked after every chunk and when closing, and std::ios_base::failure is thrown once it is no longer
+ * good.
+ * @tparam T The record type.
+ *
+ * @example
+ * @code
+ * std::ofstream out("trades.rec", std::ios::binary);
+ * ctti::record_file_writer<Trade> writer(out);
+ * for (const Trade& trade : feed) {
+ *   writer.write(trade);
+ * }
+ * writer.close();
+ * @endcode
+ */
+template <record_storable T>
+class record_file_writer {
+private:
+  using internal_columns = detail::RecordColumnsOf<T>;
+  using chunk_offsets = std::array<std::uint64_t, internal_columns::kCount>;
+
+public:
+  /// Number of records per chunk unless another size is given.
+  static constexpr std::size_t default_chunk_size = 65536;
+
+  /**
+   * @brief Constructs a writer and writes the file header.
+   * @param stream The binary stream to write to, which must outlive the writer.
+   * @param chunk_size The number of records buffered before a chunk is flushed.
+   */
+  explicit record_file_writer(std::ostream& stream, std::size_t chunk_size = default_chunk_size)
+      : stream_(&stream), chunk_size_(std::max<std::size_t>(chunk_size, 1)) {
+    const detail::RecordFileHeader header{detail::kRecordFileMagic, detail::kRecordFileFormatVersion,
+                                          detail::kRecordFileByteOrderMark,
+                                          static_cast<std::uint32_t>(internal_columns::kCount), 0, schema_hash<T>()};
+    detail::WriteRecordFileValue(*stream_, header, position_);
+    detail::CheckRecordFileStream(*stream_);
+    pending_.reserve(chunk_size_);
+  }
+
+  record_file_writer(const record_file_writer&) = delete;
+  record_file_writer& operator=(const record_file_writer&) = delete;
+
+  /**
+   * @brief Closes the file if close was not called.
+   * @details Errors are swallowed, since a destructor cannot report them. Call close to find out whether the file was
+   * written completely.
+   */
+  ~record_file_writer() noexcept {
+    if (!closed_) {
+      try {
+        close();
+      } catch (...) {
+      }
+    }
+  }
+
+  /**
+   * @brief Appends a record, flushing a chunk when the buffer is full.
+   * @param record The record to append.
+   */
+  void write(const T& record) {
+    pending_.push_back(record);
+    if (pending_.size() == chunk_size_) {
+      flush();
+    }
+  }
+
+  /**
+   * @brief Appends a range of records. Full chunks are written straight from the range without buffering them.
+   * @param records The records to append.
+   */
+  void write(std::span<const T> records) {
+    while (!records.empty()) {
+      if (pending_.empty() && records.size() >= chunk_size_) {
+        WriteChunk(records.first(chunk_size_));
+        records = records.subspan(chunk_size_);
+        continue;
+      }
+      const std::size_t count = std::min(chunk_size_ - pending_.size(), records.size());
+      pending_.insert(pending_.end(), records.begin(), records.begin() + count);
+      records = records.subspan(count);
+      if (pending_.size() == chunk_size_) {
+        flush();
+      }
+    }
+  }
+
+  /**
+   * @brief Writes the buffered records as a chunk, if there are any.
+   * @throws std::ios_base::failure If the stream is not good after writing the chunk.
+   */
+  void flush() {
+    if (!pending_.empty()) {
+      WriteChunk(pending_);
+      pending_.clear();
+    }
+  }
+
+  /**
+   * @brief Flushes the buffered records and writes the directory and footer. No records can be written afterwards.
+   * @details The writer counts as closed even if this throws, so the destructor does not write a second directory.
+   * @throws std::ios_base::failure If the stream is not good after writing the file.
+   */
+  void close() {
+    closed_ = true;
+    flush();
+    const std::uint64_t directory_offset = position_;
+    for (const detail::RecordFileColumn& column : internal_columns::kColumns) {
+      detail::WriteRecordFileValue(*stream_, column, position_);
+    }
+    for (std::size_t chunk = 0; chunk < chunk_sizes_.size(); ++chunk) {
+      detail::WriteRecordFileValue(*stream_, chunk_sizes_[chunk], position_);
+      detail::WriteRecordFileValue(*stream_, chunk_offsets_[chunk], position_);
+    }
+    const detail::RecordFileFooter footer{directory_offset, chunk_sizes_.size(), record_count_,
+                                          detail::kRecordFileMagic};
+    detail::WriteRecordFileValue(*stream_, footer, position_);
+    stream_->flush();
+    detail::CheckRecordFileStream(*stream_);
+  }
+
+  /**
+   * @brief Gets the number of records written so far, including buffered ones.
+   * @return The number of records.
+   */
+  [[nodiscard]] std::size_t record_count() const noexcept {
+    return static_cast<std::size_t>(record_count_) + pending_.size();
+  }
+
+private:
+  void WriteChunk(std::span<const T> records) {
+    chunk_offsets offsets = {};
+    internal_columns::WriteChunk(*stream_, records, position_, scratch_, offsets);
+    detail::CheckRecordFileStream(*stream_);
+    chunk_sizes_.push_back(records.size());
+    chunk_offsets_.push_back(offsets);
+    record_count_ += records.size();
+  }
+
+  std::ostream* stream_;
+  std::size_t chunk_size_;
+  std::vector<T> pending_;
+  std::vector<std::byte> scratch_;
+  std::vector<std::uint64_t> chunk_sizes_;
+  std::vector<chunk_offsets> chunk_offsets_;
+  std::uint64_t position_ = 0;
+  std::uint64_t record_count_ = 0;
+  bool closed_ = false;
+};
+
+/**
+ * @brief A read-only record file in memory, such as a memory-mapped file.
+ * @details Opening the file validates its header, directory and footer against T once. Columns are then read as
+ * typed spans straight from the buffer, with no parsing.
+ * @tparam T The record type.
+ *
+ * @example
+ * @code
+ * auto file = ctti::record_file<Trade>::open(mapped_bytes);
+ * if (file) {
+ *   for (std::size_t chunk = 0; chunk < file->chunk_count(); ++chunk) {
+ *     for (double quantity : file->column<"quantity">(chunk)) {
+ *       volume += quantity;
+ *     }
+ *   }
+ * }
+ * @endcode
+ */
+template <record_storable T>
+class record_file {
+private:
+  using internal_columns = detail::RecordColumnsOf<T>;
+
+  template <detail::CompileTimeString Name>
+  static constexpr std::size_t column_index = internal_columns::template kIndexOf<Name>;
+
+  static constexpr std::size_t header_size = sizeof(detail::RecordFileHeader);
+  static constexpr std::size_t footer_size = sizeof(detail::RecordFileFooter);
+  static constexpr std::size_t chunk_entry_size = sizeof(std::uint64_t) * (internal_columns::kCount + 1);
+
+public:
+  /// Number of columns, one per leaf of T.
+  static constexpr std::size_t column_count = internal_columns::kCount;
+
+  /// Dotted paths of the columns, in file order.
+  static constexpr std::array<std::string_view, column_count> column_names = internal_columns::kNames;
+
+  /**
+   * @brief The type of the values in the column with the given name.
+   * @tparam Name The compile-time string representing the dotted path of the leaf.
+   */
+  template <detail::CompileTimeString Name>
+    requires(column_index<Name> < column_count)
+  using column_type = typename internal_columns::template ValueType<column_index<Name>>;
+
+  /**
+   * @brief Validates a record file and opens it.
+   * @param bytes The contents of the file, which must outlive the record_file.
+   * @return The opened file, or an empty optional if the bytes are not a well-formed record file of T, including when
+   * the file was written for a different schema or on a machine with the other byte order.
+   */
+  [[nodiscard]] static std::optional<record_file> open(std::span<const std::byte> bytes) noexcept {
+    if (bytes.size() < header_size + footer_size) {
+      return std::nullopt;
+    }
+    const auto header = detail::LoadRecordFileValue<detail::RecordFileHeader>(bytes, 0);
+    const auto footer = detail::LoadRecordFileValue<detail::RecordFileFooter>(bytes, bytes.size() - footer_size);
+    if (header.magic != detail::kRecordFileMagic || footer.magic != detail::kRecordFileMagic ||
+        header.byte_order_mark != detail::kRecordFileByteOrderMark ||
+        header.format_version != detail::kRecordFileFormatVersion || header.column_count != column_count ||
+        header.schema_hash != schema_hash<T>()) {
+      return std::nullopt;
+    }
+
+    const std::size_t directory_end = bytes.size() - footer_size;
+    const std::size_t columns_size = column_count * sizeof(detail::RecordFileColumn);
+    if (footer.directory_offset < header_size || footer.directory_offset > directory_end ||
+        directory_end - footer.directory_offset < columns_size ||
+        (directory_end - footer.directory_offset - columns_size) / chunk_entry_size != footer.chunk_count ||
+        (directory_end - footer.directory_offset - columns_size) % chunk_entry_size != 0) {
+      return std::nullopt;
+    }
+
+    record_file file(bytes, static_cast<std::size_t>(footer.directory_offset + columns_size),
+                     static_cast<std::size_t>(footer.chunk_count), static_cast<std::size_t>(footer.record_count));
+    if (!file.ValidColumns(static_cast<std::size_t>(footer.directory_offset)) || !file.ValidChunks()) {
+      return std::nullopt;
+    }
+    return file;
+  }
+
+  /**
+   * @brief Gets the total number of records.
+   * @return The number of records in all chunks.
+   */
+  [[nodiscard]] std::size_t record_count() const noexcept { return record_count_; }
+
+  /**
+   * @brief Gets the number of chunks.
+   * @return The number of chunks.
+   */
+  [[nodiscard]] std::size_t chunk_count() const noexcept { return chunk_count_; }
+
+  /**
+   * @brief Gets the number of records in a chunk.
+   * @param chunk The index of the chunk, less than chunk_count().
+   * @return The number of records in the chunk.
+   */
+  [[nodiscard]] std::size_t chunk_size(std::size_t chunk) const noexcept {
+    return static_cast<std::size_t>(detail::LoadRecordFileValue<std::uint64_t>(bytes_, ChunkEntryOffset(chunk)));
+  }
+
+  /**
+   * @brief Gets the values of a column within a chunk.
+   * @tparam Name The compile-time string representing the dotted path of the leaf.
+   * @param chunk The index of the chunk, less than chunk_count().
+   * @return A span over the values, pointing into the file.
+   */
+  template <detail::CompileTimeString Name>
+    requires(column_index<Name> < column_count)
+  [[nodiscard]] std::span<const column_type<Name>> column(std::size_t chunk) const noexcept {
+    const std::size_t offset = ColumnOffset(chunk, column_index<Name>);
+    return {reinterpret_cast<const column_type<Name>*>(bytes_.data() + offset), chunk_size(chunk)};
+  }
+
+private:
+  record_file(std::span<const std::byte> bytes, std::size_t chunks_offset, std::size_t chunk_count,
+              std::size_t record_count) noexcept
+      : bytes_(bytes), chunks_offset_(chunks_offset), chunk_count_(chunk_count), record_count_(record_count) {}
+
+  [[nodiscard]] std::size_t ChunkEntryOffset(std::size_t chunk) const noexcept {
+    return chunks_offset_ + chunk * chunk_entry_size;
+  }
+
+  [[nodiscard]] std::size_t ColumnOffset(std::size_t chunk, std::size_t column) const noexcept {
+    return static_cast<std::size_t>(detail::LoadRecordFileValue<std::uint64_t>(
+        bytes_, ChunkEntryOffset(chunk) + sizeof(std::uint64_t) * (column + 1)));
+  }
+
+  [[nodiscard]] bool ValidColumns(std::size_t directory_offset) const noexcept {
+    for (std::size_t i = 0; i < column_count; ++i) {
+      const auto column = detail::LoadRecordFileValue<detail::RecordFileColumn>(
+          bytes_, directory_offset + i * sizeof(detail::RecordFileColumn));
+      const auto& expected = internal_columns::kColumns[i];
+      if (column.name_hash != expected.name_hash || column.element_size != expected.element_size ||
+          column.element_alignment != expected.element_alignment) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  // Every column block must lie before the directory and be aligned for its values in memory
+  [[nodiscard]] bool ValidChunks() const noexcept {
+    const std::size_t data_end = chunks_offset_ - column_count * sizeof(detail::RecordFileColumn);
+    std::size_t total = 0;
+    for (std::size_t chunk = 0; chunk < chunk_count_; ++chunk) {
+      const std::size_t size = chunk_size(chunk);
+      for (std::size_t i = 0; i < column_count; ++i) {
+        const auto& column = internal_columns::kColumns[i];
+        const std::size_t offset = ColumnOffset(chunk, i);
+        if (offset < header_size || offset > data_end || size > (data_end - offset) / column.element_size ||
+            reinterpret_cast<std::uintptr_t>(bytes_.data() + offset) % column.element_alignment != 0) {
+          return false;
+        }
+      }
+      total += size;
+    }
+    return total == record_count_;
+  }
+
+  std::span<const std::byte> bytes_;
+  std::size_t chunks_offset_;
+  std::size_t chunk_count_;
+  std::size_t record_count_;
+};
+
+}  // namespace ctti
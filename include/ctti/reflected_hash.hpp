@@ -0,0 +1,52 @@
+#pragma once
+
+#include <ctti/detail/reflected_hash_impl.hpp>
+#include <ctti/reflection.hpp>
+
+#include <cstddef>
+
+namespace ctti {
+
+/**
+ * @brief Concept that checks if every data member of a reflectable type can be hashed.
+ * @details A data member is hashable if it is itself reflectable and hashable, has a std::hash specialization, or is
+ * a range of hashable elements.
+ * @tparam T The type to check.
+ */
+template <typename T>
+concept reflected_hashable = reflectable<T> && detail::ReflectedHashable<T>;
+
+/**
+ * @brief Computes a hash of an object from its reflected data members.
+ * @details When T has a unique object representation and its data members cover every byte of it, the raw bytes
+ * of the object are hashed in a single pass. Otherwise the hashes of the data members are combined in declaration
+ * order of the reflection.
+ * @tparam T The reflectable type of the object.
+ * @param object The object to hash.
+ * @return The hash of the object.
+ */
+template <reflected_hashable T>
+[[nodiscard]] std::size_t hash_value(const T& object) {
+  return detail::HashObject(object);
+}
+
+/**
+ * @brief A hash function object for reflectable types, suitable for unordered containers.
+ * @tparam T The reflectable type to hash.
+ *
+ * @example
+ * @code
+ * std::unordered_set<Point, ctti::reflected_hash<Point>> points;
+ * @endcode
+ */
+template <reflected_hashable T>
+struct reflected_hash {
+  /**
+   * @brief Computes the hash of an object.
+   * @param object The object to hash.
+   * @return The hash of the object.
+   */
+  [[nodiscard]] std::size_t operator()(const T& object) const { return hash_value(object); }
+};
+
+}  // namespace ctti
@@ -8,6 +8,7 @@
 #include <concepts>
 #include <cstddef>
 #include <string_view>
+#include <type_traits>
 
 namespace ctti {
 
@@ -162,6 +163,50 @@ concept reflectable = requires {
   requires meta<T>::reflection.size > 0;
 };
 
+namespace detail {
+
+template <typename Reflection>
+struct ReflectionTraits;
+
+template <typename InternalReflection>
+struct ReflectionTraits<reflection<InternalReflection>> {
+  using InternalType = InternalReflection;
+};
+
+template <reflectable T>
+using ReflectionOf = typename ReflectionTraits<std::remove_cvref_t<decltype(meta<T>::reflection)>>::InternalType;
+
+template <reflectable T>
+using DataMemberDefinitionsOf = typename ReflectionOf<T>::DataMemberDefinitionsType;
+
+// True when T has no padding and its reflected data members cover every byte of it, so that comparing or hashing
+// the raw bytes is equivalent to doing so field by field
+template <reflectable T>
+constexpr bool kReflectsObjectRepresentation =
+    std::has_unique_object_representations_v<T> && DataMembersSize<DataMemberDefinitionsOf<T>>::value == sizeof(T);
+
+template <typename T>
+struct IsStdArray : FalseType {};
+
+template <typename T, std::size_t N>
+struct IsStdArray<std::array<T, N>> : TrueType {};
+
+// True when equality of T is equality of its object representation, so runs of T can be compared with memcmp
+template <typename T>
+[[nodiscard]] consteval bool IsBytewiseComparable() noexcept {
+  if constexpr (reflectable<T>) {
+    return kReflectsObjectRepresentation<T>;
+  } else if constexpr (std::is_array_v<T>) {
+    return IsBytewiseComparable<std::remove_all_extents_t<T>>();
+  } else if constexpr (IsStdArray<T>::value) {
+    return std::has_unique_object_representations_v<T> && IsBytewiseComparable<typename T::value_type>();
+  } else {
+    return std::is_scalar_v<T> && std::has_unique_object_representations_v<T>;
+  }
+}
+
+}  // namespace detail
+
 /**
  * @brief Retrieves the reflection associated with a given type T.
  * @tparam T The type for which to retrieve the reflection.
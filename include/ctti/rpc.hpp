@@ -0,0 +1,113 @@
+#pragma once
+
+#include <ctti/detail/compile_time_string.hpp>
+#include <ctti/detail/hash_impl.hpp>
+#include <ctti/detail/rpc_impl.hpp>
+#include <ctti/reflection.hpp>
+
+#include <cstddef>
+#include <string_view>
+
+namespace ctti {
+
+/**
+ * @brief Computes the hash of an argument signature, as used to select an overload in rpc_dispatcher.
+ * @details The hash covers the names of the argument types with references and cv-qualifiers removed.
+ * @tparam Args The argument types of the method.
+ * @return The signature hash.
+ */
+template <typename... Args>
+[[nodiscard]] constexpr std::size_t rpc_signature_hash() noexcept {
+  return detail::SignatureHash<Args...>();
+}
+
+/**
+ * @brief Computes the dispatch key of a method from its name and signature hash.
+ * @param name The name of the method symbol.
+ * @param signature The signature hash, from rpc_signature_hash.
+ * @return The dispatch key.
+ */
+[[nodiscard]] constexpr std::size_t rpc_method_key(std::string_view name, std::size_t signature) noexcept {
+  return detail::MethodKey(name, signature);
+}
+
+/**
+ * @brief Computes the dispatch key of a method at compile time.
+ * @tparam Name The compile-time string representing the name of the method symbol.
+ * @tparam Args The argument types of the overload to call.
+ * @return The dispatch key.
+ */
+template <detail::CompileTimeString Name, typename... Args>
+[[nodiscard]] constexpr std::size_t rpc_method_key() noexcept {
+  return detail::MethodKey(Name.View(), detail::SignatureHash<Args...>());
+}
+
+/**
+ * @brief A dispatch table that invokes the reflected member functions of T by name at runtime.
+ * @details Every member function reflected through member or overloaded_member gets one entry, keyed by the hash of
+ * its name and argument signature. A call costs one perfect hash lookup and one indirect call to a thunk. The thunk
+ * reads the arguments in order with reader.read<Arg>(), invokes the member function and passes its result, if it
+ * is not void, to writer.write(result).
+ * @tparam T The reflectable type whose member functions are dispatched.
+ * @tparam Reader The type the arguments are read from.
+ * @tparam Writer The type results are written to.
+ *
+ * @example
+ * @code
+ * using dispatcher = ctti::rpc_dispatcher<Account, Decoder, Encoder>;
+ *
+ * if (!dispatcher::dispatch(account, request.method, request.signature, decoder, encoder)) {
+ *   reply_unknown_method();
+ * }
+ * @endcode
+ */
+template <reflectable T, typename Reader, typename Writer>
+class rpc_dispatcher {
+private:
+  using internal_table = detail::DispatchTableOf<T, Reader, Writer>;
+
+public:
+  /// Number of dispatchable member function overloads.
+  static constexpr std::size_t method_count = internal_table::kCount;
+
+  /**
+   * @brief Checks if a method with the given dispatch key exists.
+   * @param key The dispatch key, from rpc_method_key.
+   * @return True if the method exists, false otherwise.
+   */
+  [[nodiscard]] static constexpr bool has_method(std::size_t key) noexcept {
+    return internal_table::kIndex.Find(key) < method_count;
+  }
+
+  /**
+   * @brief Invokes the method with the given dispatch key.
+   * @param object The object to invoke the method on.
+   * @param key The dispatch key, from rpc_method_key.
+   * @param reader The source of the arguments.
+   * @param writer The destination of the result.
+   * @return True if the method exists and was invoked, false otherwise.
+   */
+  static bool dispatch(T& object, std::size_t key, Reader& reader, Writer& writer) {
+    const std::size_t index = internal_table::kIndex.Find(key);
+    if (index == method_count) {
+      return false;
+    }
+    internal_table::kThunks[index](object, reader, writer);
+    return true;
+  }
+
+  /**
+   * @brief Invokes the method with the given name and signature hash.
+   * @param object The object to invoke the method on.
+   * @param name The name of the method symbol.
+   * @param signature The signature hash, from rpc_signature_hash.
+   * @param reader The source of the arguments.
+   * @param writer The destination of the result.
+   * @return True if the method exists and was invoked, false otherwise.
+   */
+  static bool dispatch(T& object, std::string_view name, std::size_t signature, Reader& reader, Writer& writer) {
+    return dispatch(object, rpc_method_key(name, signature), reader, writer);
+  }
+};
+
+}  // namespace ctti
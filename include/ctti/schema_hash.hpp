@@ -0,0 +1,58 @@
+#pragma once
+
+#include <ctti/detail/schema_hash_impl.hpp>
+#include <ctti/reflection.hpp>
+
+#include <cstdint>
+#include <type_traits>
+
+namespace ctti {
+
+/**
+ * @brief Computes a fingerprint of the reflected schema and the value layout of a type at compile time.
+ * @details Hashes the native byte order, the size and alignment of T, and the name, size, alignment, value type name
+ * and attributes of every data member in reflection order. Data members of reflectable types, and ranges of them,
+ * contribute the schema hash of that type instead of its name. Two types with the same schema hash have the same
+ * reflected schema, and their data members have the same sizes, alignments and byte order, so the values of each
+ * member can be copied as raw bytes between them. Member offsets cannot be computed in a constant expression, so two
+ * types that only differ in the declaration order of their data members share a schema hash. Use layout_hash when
+ * whole objects are copied as raw bytes.
+ * @tparam T The reflectable type.
+ * @return The 64-bit schema hash of T, the same on every platform with the same byte order and layout.
+ *
+ * @example
+ * @code
+ * if (header.schema == ctti::schema_hash<Record>()) {
+ *   read_fields(payload, records);
+ * } else {
+ *   migrate(payload, header.schema, records);
+ * }
+ * @endcode
+ */
+template <reflectable T>
+[[nodiscard]] constexpr std::uint64_t schema_hash() noexcept {
+  return detail::SchemaHash<T>();
+}
+
+/**
+ * @brief Computes a fingerprint of the schema and the full object layout of a type at runtime.
+ * @details Extends schema_hash with the offset of every data member, recursing into reflectable data members. Two
+ * standard-layout types with the same layout hash place the same members at the same offsets, so their objects can
+ * be copied as raw bytes or mapped straight from a file written by the other.
+ * @tparam T The standard-layout reflectable type.
+ * @return The 64-bit layout hash of T.
+ *
+ * @example
+ * @code
+ * if (header.layout == ctti::layout_hash<Tick>()) {
+ *   auto ticks = std::span(reinterpret_cast<const Tick*>(mapped.data()), header.count);
+ * }
+ * @endcode
+ */
+template <reflectable T>
+  requires std::is_standard_layout_v<T>
+[[nodiscard]] std::uint64_t layout_hash() noexcept {
+  return detail::LayoutHash<T>();
+}
+
+}  // namespace ctti
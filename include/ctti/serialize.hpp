@@ -0,0 +1,285 @@
+#pragma once
+
+#include <ctti/detail/execution_impl.hpp>
+#include <ctti/detail/serialize_impl.hpp>
+#include <ctti/execution.hpp>
+#include <ctti/reflection.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <numeric>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace ctti {
+
+/**
+ * @brief Concept that checks if a reflectable type can be serialized from its data members.
+ * @details Data members must be arithmetic values, enums, strings, vectors or arrays of serializable values, or
+ * serializable reflectable types themselves.
+ * @tparam T The type to check.
+ */
+template <typename T>
+concept serializable = reflectable<T> && detail::Serializable<T>::value;
+
+/**
+ * @brief The latest schema version of a serializable type.
+ * @details The highest since<Version> attribute among the data members of T and of the reflectable types nested in
+ * it, or 0 if none of them has one.
+ * @tparam T The serializable type.
+ */
+template <serializable T>
+inline constexpr int schema_version = detail::SchemaVersion<T>::value;
+
+/**
+ * @brief Appends serialized values to a growing byte buffer.
+ */
+class byte_writer {
+public:
+  /**
+   * @brief Appends raw bytes to the buffer.
+   * @param data The bytes to append.
+   * @param size The number of bytes to append.
+   */
+  void write_bytes(const void* data, std::size_t size) {
+    const std::size_t offset = buffer_.size();
+    buffer_.resize(offset + size);
+    if (size != 0) {
+      std::memcpy(buffer_.data() + offset, data, size);
+    }
+  }
+
+  /**
+   * @brief Appends bytes for the caller to fill in.
+   * @param size The number of bytes to append.
+   * @return The appended bytes, valid until the next call that appends to the writer.
+   */
+  [[nodiscard]] std::span<std::byte> allocate(std::size_t size) {
+    const std::size_t offset = buffer_.size();
+    buffer_.resize(offset + size);
+    return std::span<std::byte>(buffer_).subspan(offset);
+  }
+
+  /**
+   * @brief Gets the bytes written so far.
+   * @return The buffer.
+   */
+  [[nodiscard]] const std::vector<std::byte>& bytes() const noexcept { return buffer_; }
+
+  /**
+   * @brief Moves the written bytes out of the writer, leaving it empty.
+   * @return The buffer.
+   */
+  [[nodiscard]] std::vector<std::byte> release() noexcept { return std::exchange(buffer_, {}); }
+
+  /**
+   * @brief Gets the number of bytes written so far.
+   * @return The size of the buffer.
+   */
+  [[nodiscard]] std::size_t size() const noexcept { return buffer_.size(); }
+
+  /**
+   * @brief Discards the written bytes, keeping the allocated capacity.
+   */
+  void clear() noexcept { buffer_.clear(); }
+
+private:
+  std::vector<std::byte> buffer_;
+};
+
+/**
+ * @brief Reads serialized values from a span of bytes.
+ */
+class byte_reader {
+public:
+  /**
+   * @brief Constructs a reader over a span of bytes, which must outlive the reader.
+   * @param bytes The bytes to read.
+   */
+  constexpr explicit byte_reader(std::span<const std::byte> bytes) noexcept : bytes_(bytes) {}
+
+  /**
+   * @brief Copies the next bytes out of the span.
+   * @param data The destination.
+   * @param size The number of bytes to copy.
+   * @return True if enough bytes were left, false otherwise, in which case nothing is consumed.
+   */
+  [[nodiscard]] bool read_bytes(void* data, std::size_t size) noexcept {
+    if (size > remaining()) {
+      return false;
+    }
+    if (size != 0) {
+      std::memcpy(data, bytes_.data() + position_, size);
+    }
+    position_ += size;
+    return true;
+  }
+
+  /**
+   * @brief Consumes the next bytes without copying them.
+   * @param size The number of bytes to consume.
+   * @param bytes Set to the consumed bytes, which point into the span the reader was constructed with.
+   * @return True if enough bytes were left, false otherwise, in which case nothing is consumed.
+   */
+  [[nodiscard]] bool read_span(std::size_t size, std::span<const std::byte>& bytes) noexcept {
+    if (size > remaining()) {
+      return false;
+    }
+    bytes = bytes_.subspan(position_, size);
+    position_ += size;
+    return true;
+  }
+
+  /**
+   * @brief Gets the number of bytes consumed so far.
+   * @return The read position.
+   */
+  [[nodiscard]] constexpr std::size_t position() const noexcept { return position_; }
+
+  /**
+   * @brief Gets the number of bytes left to read.
+   * @return The number of remaining bytes.
+   */
+  [[nodiscard]] constexpr std::size_t remaining() const noexcept { return bytes_.size() - position_; }
+
+private:
+  std::span<const std::byte> bytes_;
+  std::size_t position_ = 0;
+};
+
+/**
+ * @brief Serializes an object as it looked at a given schema version.
+ * @details Only data members whose since<Version> attribute is not greater than Version are written, selected at
+ * compile time. Values are written in reflection order with the native byte order, and strings and vectors are
+ * prefixed with their element count.
+ * @tparam Version The schema version to write.
+ * @tparam T The serializable type of the object.
+ * @param object The object to serialize.
+ * @param writer The writer to append to.
+ *
+ * @example
+ * @code
+ * ctti::byte_writer writer;
+ * ctti::serialize<1>(order, writer);  // Readable by services that only know version 1
+ * @endcode
+ */
+template <int Version, serializable T>
+  requires(Version >= 0)
+void serialize(const T& object, byte_writer& writer) {
+  detail::WriteValue<Version>(writer, object);
+}
+
+/**
+ * @brief Serializes an object at its latest schema version.
+ * @tparam T The serializable type of the object.
+ * @param object The object to serialize.
+ * @param writer The writer to append to.
+ */
+template <serializable T>
+void serialize(const T& object, byte_writer& writer) {
+  detail::WriteValue<schema_version<T>>(writer, object);
+}
+
+/**
+ * @brief Deserializes an object written at a given schema version.
+ * @details The version selects one of the readers instantiated for every version up to schema_version<T>, so the
+ * data members a payload lacks are skipped without checking them one by one. They keep the value they had in the
+ * object.
+ * @tparam T The serializable type of the object.
+ * @param reader The reader to consume.
+ * @param object The object to read into.
+ * @param version The schema version the payload was written at.
+ * @return True on success, false if the version is newer than schema_version<T> or the payload is truncated.
+ *
+ * @example
+ * @code
+ * ctti::byte_reader reader(message.payload);
+ * Order order;
+ * if (!ctti::deserialize(reader, order, message.version)) {
+ *   reject(message);
+ * }
+ * @endcode
+ */
+template <serializable T>
+[[nodiscard]] bool deserialize(byte_reader& reader, T& object, int version = schema_version<T>) {
+  using readers = detail::VersionedReadersOf<T, byte_reader>;
+  if (version < 0 || version > schema_version<T>) {
+    return false;
+  }
+  return readers::kReaders[static_cast<std::size_t>(version)](reader, object);
+}
+
+/**
+ * @brief Serializes a range of objects at a given schema version, splitting the work across threads.
+ * @details The output is the same as serializing the objects one after the other. When every T takes the same number
+ * of bytes, the output is allocated once and each thread writes its chunk of objects straight into place. Otherwise
+ * every chunk is serialized into its own buffer, and the buffers are copied into place at offsets given by a prefix
+ * sum of their sizes. In both cases chunks hold about policy.chunk_bytes bytes, estimated from the fixed-size part of
+ * T.
+ * @tparam Version The schema version to write.
+ * @tparam T The serializable type of the objects.
+ * @param objects The objects to serialize.
+ * @param writer The writer to append to.
+ * @param policy How to split the work across threads.
+ *
+ * @example
+ * @code
+ * ctti::byte_writer writer;
+ * ctti::serialize_range<2>(std::span<const Particle>(particles), writer, ctti::par);
+ * @endcode
+ */
+template <int Version, serializable T>
+  requires(Version >= 0)
+void serialize_range(std::span<const T> objects, byte_writer& writer, const exec_policy& policy = par) {
+  using size_info = detail::SerializedSize<T, Version>;
+  const std::size_t chunk_length = detail::ChunkLength(policy, size_info::kMinimum);
+  const std::size_t chunk_count = (objects.size() + chunk_length - 1) / chunk_length;
+  const auto chunk_of = [&](std::size_t chunk) {
+    return objects.subspan(chunk * chunk_length, std::min(chunk_length, objects.size() - chunk * chunk_length));
+  };
+
+  if constexpr (size_info::kFixed) {
+    const std::span<std::byte> output = writer.allocate(objects.size() * size_info::kMinimum);
+    detail::ParallelFor(chunk_count, policy, [&](std::size_t chunk) {
+      detail::SpanWriter chunk_writer{output.data() + chunk * chunk_length * size_info::kMinimum};
+      for (const T& object : chunk_of(chunk)) {
+        detail::WriteValue<Version>(chunk_writer, object);
+      }
+    });
+  } else {
+    std::vector<byte_writer> chunk_writers(chunk_count);
+    detail::ParallelFor(chunk_count, policy, [&](std::size_t chunk) {
+      for (const T& object : chunk_of(chunk)) {
+        detail::WriteValue<Version>(chunk_writers[chunk], object);
+      }
+    });
+
+    std::vector<std::size_t> offsets(chunk_count + 1, 0);
+    std::transform_inclusive_scan(chunk_writers.begin(), chunk_writers.end(), offsets.begin() + 1, std::plus<>{},
+                                  [](const byte_writer& chunk_writer) { return chunk_writer.size(); });
+    const std::span<std::byte> output = writer.allocate(offsets.back());
+    detail::ParallelFor(chunk_count, policy, [&](std::size_t chunk) {
+      const auto& bytes = chunk_writers[chunk].bytes();
+      if (!bytes.empty()) {
+        std::memcpy(output.data() + offsets[chunk], bytes.data(), bytes.size());
+      }
+    });
+  }
+}
+
+/**
+ * @brief Serializes a range of objects at their latest schema version, splitting the work across threads.
+ * @tparam T The serializable type of the objects.
+ * @param objects The objects to serialize.
+ * @param writer The writer to append to.
+ * @param policy How to split the work across threads.
+ */
+template <serializable T>
+void serialize_range(std::span<const T> objects, byte_writer& writer, const exec_policy& policy = par) {
+  serialize_range<schema_version<T>>(objects, writer, policy);
+}
+
+}  // namespace ctti
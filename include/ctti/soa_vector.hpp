@@ -0,0 +1,282 @@
+#pragma once
+
+#include <ctti/detail/compile_time_string.hpp>
+#include <ctti/detail/soa_vector_impl.hpp>
+#include <ctti/reflection.hpp>
+
+#include <concepts>
+#include <cstddef>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+namespace ctti {
+
+/**
+ * @brief A structure-of-arrays container for reflectable types.
+ * @details Every data member symbol of T is stored in its own contiguous, cache-line aligned column, so loops
+ * touching a single field only pull that field into cache. Member function symbols are ignored.
+ * @tparam T The reflectable type whose data members become columns.
+ *
+ * @example
+ * @code
+ * ctti::soa_vector<Point> points;
+ * points.push_back(Point{1.0, 2.0});
+ *
+ * for (double& x : points.column<"x">()) {
+ *   x *= 2.0;
+ * }
+ *
+ * double y = points[0].get<"y">();
+ * Point p = points[0].load();
+ * @endcode
+ */
+template <reflectable T>
+class soa_vector {
+private:
+  using internal_storage = detail::SoaStorage<T, detail::DataMemberDefinitionsOf<T>>;
+
+  template <detail::CompileTimeString Name>
+  static constexpr std::size_t column_index = internal_storage::template kColumnIndexOf<Name>;
+
+public:
+  using value_type = T;
+  using size_type = std::size_t;
+
+  /// Number of columns, one per data member symbol of T.
+  static constexpr std::size_t column_count = internal_storage::kColumnCount;
+
+  /**
+   * @brief Checks if T has a column with the given name.
+   * @tparam Name The compile-time string representing the name of the column.
+   * @return True if a data member symbol with that name exists, false otherwise.
+   */
+  template <detail::CompileTimeString Name>
+  [[nodiscard]] static constexpr bool has_column() noexcept {
+    return column_index<Name> < column_count;
+  }
+
+  /**
+   * @brief The element type stored in the column with the given name.
+   * @tparam Name The compile-time string representing the name of the column.
+   */
+  template <detail::CompileTimeString Name>
+    requires(has_column<Name>())
+  using column_type = typename internal_storage::template ColumnValueType<column_index<Name>>;
+
+  /**
+   * @brief A proxy for a single row that gives access to each field of the row by name.
+   * @tparam Const Whether the proxy provides read-only access.
+   */
+  template <bool Const>
+  class row_proxy {
+  private:
+    using owner_type = std::conditional_t<Const, const soa_vector, soa_vector>;
+
+  public:
+    /// The type of the record the proxy stands for, which lets symbol::get_value and set_value accept the proxy.
+    using record_type = T;
+
+    constexpr row_proxy(owner_type& owner, size_type index) noexcept : owner_(&owner), index_(index) {}
+    constexpr row_proxy(const row_proxy&) noexcept = default;
+    constexpr row_proxy(row_proxy&&) noexcept = default;
+    constexpr ~row_proxy() noexcept = default;
+
+    /**
+     * @brief Assigns the field values of another row to this row.
+     * @param other The row to copy the field values from.
+     * @return A reference to this proxy.
+     */
+    row_proxy& operator=(const row_proxy& other)
+      requires(!Const)
+    {
+      return *this = other.load();
+    }
+
+    /**
+     * @brief Stores the data members of an object into this row.
+     * @param object The object to store.
+     * @return A reference to this proxy.
+     */
+    row_proxy& operator=(const T& object)
+      requires(!Const)
+    {
+      owner_->storage_.Store(index_, object);
+      return *this;
+    }
+
+    /**
+     * @brief Moves the data members of an object into this row.
+     * @param object The object to store.
+     * @return A reference to this proxy.
+     */
+    row_proxy& operator=(T&& object)
+      requires(!Const)
+    {
+      owner_->storage_.Store(index_, std::move(object));
+      return *this;
+    }
+
+    /**
+     * @brief Gets a reference to the field with the given name.
+     * @tparam Name The compile-time string representing the name of the field.
+     * @return A reference to the field, const if the proxy is read-only.
+     */
+    template <detail::CompileTimeString Name>
+      requires(has_column<Name>())
+    [[nodiscard]] decltype(auto) get() const noexcept {
+      return owner_->template column<Name>()[index_];
+    }
+
+    /**
+     * @brief Sets the field with the given name.
+     * @tparam Name The compile-time string representing the name of the field.
+     * @tparam Value The type of the value to set.
+     * @param value The value to set.
+     */
+    template <detail::CompileTimeString Name, typename Value>
+      requires(!Const && has_column<Name>() && std::assignable_from<column_type<Name>&, Value &&>)
+    void set(Value&& value) const {
+      get<Name>() = std::forward<Value>(value);
+    }
+
+    /**
+     * @brief Gathers the row back into an object of type T.
+     * @return A default-initialized T with every reflected data member set from the row.
+     */
+    [[nodiscard]] T load() const
+      requires std::default_initializable<T>
+    {
+      return owner_->storage_.Load(index_);
+    }
+
+    [[nodiscard]] explicit operator T() const
+      requires std::default_initializable<T>
+    {
+      return load();
+    }
+
+    /**
+     * @brief Gets the index of the row.
+     * @return The index of the row in the container.
+     */
+    [[nodiscard]] constexpr size_type index() const noexcept { return index_; }
+
+  private:
+    owner_type* owner_;
+    size_type index_;
+  };
+
+  using reference = row_proxy<false>;
+  using const_reference = row_proxy<true>;
+
+  soa_vector() = default;
+
+  /**
+   * @brief Creates a container with count value-initialized rows.
+   * @param count The number of rows.
+   */
+  explicit soa_vector(size_type count) { storage_.Resize(count); }
+
+  soa_vector(const soa_vector&) = default;
+  soa_vector(soa_vector&&) noexcept = default;
+  ~soa_vector() noexcept = default;
+
+  soa_vector& operator=(const soa_vector&) = default;
+  soa_vector& operator=(soa_vector&&) noexcept = default;
+
+  /**
+   * @brief Gets the number of rows.
+   * @return The number of rows.
+   */
+  [[nodiscard]] size_type size() const noexcept { return storage_.Size(); }
+
+  /**
+   * @brief Checks if the container has no rows.
+   * @return True if the container is empty, false otherwise.
+   */
+  [[nodiscard]] bool empty() const noexcept { return storage_.Size() == 0; }
+
+  /**
+   * @brief Gets the number of rows every column can hold without reallocating.
+   * @return The capacity of the container.
+   */
+  [[nodiscard]] size_type capacity() const noexcept { return storage_.Capacity(); }
+
+  /**
+   * @brief Reserves storage for at least capacity rows in every column.
+   * @param capacity The number of rows to reserve.
+   */
+  void reserve(size_type capacity) { storage_.Reserve(capacity); }
+
+  /**
+   * @brief Resizes every column to count rows, value-initializing new fields.
+   * @param count The new number of rows.
+   */
+  void resize(size_type count) { storage_.Resize(count); }
+
+  /**
+   * @brief Removes all rows.
+   */
+  void clear() noexcept { storage_.Clear(); }
+
+  /**
+   * @brief Appends an object, scattering its data members into the columns.
+   * @param object The object to append.
+   */
+  void push_back(const T& object) { storage_.PushBack(object); }
+
+  /**
+   * @brief Appends an object, moving its data members into the columns.
+   * @param object The object to append.
+   */
+  void push_back(T&& object) { storage_.PushBack(std::move(object)); }
+
+  /**
+   * @brief Removes the last row. The container must not be empty.
+   */
+  void pop_back() noexcept { storage_.PopBack(); }
+
+  /**
+   * @brief Gets a proxy for the row at the given index.
+   * @param index The index of the row.
+   * @return A proxy giving access to the fields of the row.
+   */
+  [[nodiscard]] reference operator[](size_type index) noexcept { return reference(*this, index); }
+
+  /**
+   * @brief Gets a read-only proxy for the row at the given index.
+   * @param index The index of the row.
+   * @return A proxy giving read-only access to the fields of the row.
+   */
+  [[nodiscard]] const_reference operator[](size_type index) const noexcept { return const_reference(*this, index); }
+
+  /**
+   * @brief Gets the column with the given name as a contiguous span.
+   * @tparam Name The compile-time string representing the name of the column.
+   * @return A span over the column, with one element per row.
+   */
+  template <detail::CompileTimeString Name>
+    requires(has_column<Name>())
+  [[nodiscard]] std::span<column_type<Name>> column() noexcept {
+    auto& buffer = storage_.template ColumnAt<column_index<Name>>();
+    return {buffer.Data(), storage_.Size()};
+  }
+
+  /**
+   * @brief Gets the column with the given name as a read-only contiguous span.
+   * @tparam Name The compile-time string representing the name of the column.
+   * @return A read-only span over the column, with one element per row.
+   */
+  template <detail::CompileTimeString Name>
+    requires(has_column<Name>())
+  [[nodiscard]] std::span<const column_type<Name>> column() const noexcept {
+    const auto& buffer = storage_.template ColumnAt<column_index<Name>>();
+    return {buffer.Data(), storage_.Size()};
+  }
+
+private:
+  internal_storage storage_;
+};
+
+}  // namespace ctti
@@ -0,0 +1,268 @@
+#pragma once
+
+#include <ctti/attributes.hpp>
+#include <ctti/detail/compile_time_string.hpp>
+#include <ctti/detail/split_storage_impl.hpp>
+#include <ctti/reflection.hpp>
+
+#include <concepts>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace ctti {
+
+/**
+ * @brief A container that splits the data members of reflectable records into a hot and a cold array.
+ * @details Data members tagged ctti::hot are packed together, one record after the other, in a dense cache-line
+ * aligned array. All other data members, including the ones tagged ctti::cold, go to a second array under the same
+ * index. Loops that only touch hot fields then pull only hot fields into cache. Member function symbols are ignored.
+ * @tparam T The reflectable type of the records.
+ *
+ * @example
+ * @code
+ * ctti::split_storage<Order> orders;
+ * orders.push_back(order);
+ *
+ * double exposure = 0.0;
+ * for (std::size_t i = 0; i < orders.size(); ++i) {
+ *   exposure += orders[i].get<"price">() * orders[i].get<"quantity">();
+ * }
+ * @endcode
+ */
+template <reflectable T>
+class split_storage {
+private:
+  using internal_storage = detail::SplitStorage<T>;
+
+public:
+  using value_type = T;
+  using size_type = std::size_t;
+
+  /// Number of data members stored in the hot array.
+  static constexpr std::size_t hot_field_count = internal_storage::HotDefinitionsType::kSize;
+
+  /// Number of data members stored in the cold array.
+  static constexpr std::size_t cold_field_count = internal_storage::ColdDefinitionsType::kSize;
+
+  /**
+   * @brief Checks if T has a data member with the given name.
+   * @tparam Name The compile-time string representing the name of the data member.
+   * @return True if a data member symbol with that name exists, false otherwise.
+   */
+  template <detail::CompileTimeString Name>
+  [[nodiscard]] static constexpr bool has_field() noexcept {
+    return internal_storage::template kHasField<Name>;
+  }
+
+  /**
+   * @brief Checks if the data member with the given name is stored in the hot array.
+   * @tparam Name The compile-time string representing the name of the data member.
+   * @return True if the data member is tagged ctti::hot, false otherwise.
+   */
+  template <detail::CompileTimeString Name>
+    requires(has_field<Name>())
+  [[nodiscard]] static constexpr bool is_hot() noexcept {
+    return internal_storage::template kIsHot<Name>;
+  }
+
+  /**
+   * @brief The type of the data member with the given name.
+   * @tparam Name The compile-time string representing the name of the data member.
+   */
+  template <detail::CompileTimeString Name>
+    requires(has_field<Name>())
+  using field_type = typename internal_storage::template FieldValueType<Name>;
+
+  /**
+   * @brief A proxy for a single record that gives access to each field of the record by name.
+   * @tparam Const Whether the proxy provides read-only access.
+   */
+  template <bool Const>
+  class record_proxy {
+  private:
+    using owner_type = std::conditional_t<Const, const split_storage, split_storage>;
+
+  public:
+    /// The type of the record the proxy stands for, which lets symbol::get_value and set_value accept the proxy.
+    using record_type = T;
+
+    constexpr record_proxy(owner_type& owner, size_type index) noexcept : owner_(&owner), index_(index) {}
+    constexpr record_proxy(const record_proxy&) noexcept = default;
+    constexpr record_proxy(record_proxy&&) noexcept = default;
+    constexpr ~record_proxy() noexcept = default;
+
+    /**
+     * @brief Assigns the field values of another record to this record.
+     * @param other The record to copy the field values from.
+     * @return A reference to this proxy.
+     */
+    record_proxy& operator=(const record_proxy& other)
+      requires(!Const)
+    {
+      return *this = other.load();
+    }
+
+    /**
+     * @brief Stores the data members of an object into this record.
+     * @param object The object to store.
+     * @return A reference to this proxy.
+     */
+    record_proxy& operator=(const T& object)
+      requires(!Const)
+    {
+      owner_->storage_.Store(index_, object);
+      return *this;
+    }
+
+    /**
+     * @brief Moves the data members of an object into this record.
+     * @param object The object to store.
+     * @return A reference to this proxy.
+     */
+    record_proxy& operator=(T&& object)
+      requires(!Const)
+    {
+      owner_->storage_.Store(index_, std::move(object));
+      return *this;
+    }
+
+    /**
+     * @brief Gets a reference to the field with the given name, wherever it is stored.
+     * @tparam Name The compile-time string representing the name of the field.
+     * @return A reference to the field, const if the proxy is read-only.
+     */
+    template <detail::CompileTimeString Name>
+      requires(has_field<Name>())
+    [[nodiscard]] decltype(auto) get() const noexcept {
+      return owner_->storage_.template Field<Name>(index_);
+    }
+
+    /**
+     * @brief Sets the field with the given name.
+     * @tparam Name The compile-time string representing the name of the field.
+     * @tparam Value The type of the value to set.
+     * @param value The value to set.
+     */
+    template <detail::CompileTimeString Name, typename Value>
+      requires(!Const && has_field<Name>() && std::assignable_from<field_type<Name>&, Value &&>)
+    void set(Value&& value) const {
+      get<Name>() = std::forward<Value>(value);
+    }
+
+    /**
+     * @brief Gathers the record back into an object of type T.
+     * @return A default-initialized T with every reflected data member set from the record.
+     */
+    [[nodiscard]] T load() const
+      requires std::default_initializable<T>
+    {
+      return owner_->storage_.Load(index_);
+    }
+
+    [[nodiscard]] explicit operator T() const
+      requires std::default_initializable<T>
+    {
+      return load();
+    }
+
+    /**
+     * @brief Gets the index of the record.
+     * @return The index of the record in the container.
+     */
+    [[nodiscard]] constexpr size_type index() const noexcept { return index_; }
+
+  private:
+    owner_type* owner_;
+    size_type index_;
+  };
+
+  using reference = record_proxy<false>;
+  using const_reference = record_proxy<true>;
+
+  split_storage() = default;
+
+  /**
+   * @brief Creates a container with count value-initialized records.
+   * @param count The number of records.
+   */
+  explicit split_storage(size_type count) { storage_.Resize(count); }
+
+  split_storage(const split_storage&) = default;
+  split_storage(split_storage&&) noexcept = default;
+  ~split_storage() noexcept = default;
+
+  split_storage& operator=(const split_storage&) = default;
+  split_storage& operator=(split_storage&&) noexcept = default;
+
+  /**
+   * @brief Gets the number of records.
+   * @return The number of records.
+   */
+  [[nodiscard]] size_type size() const noexcept { return storage_.Size(); }
+
+  /**
+   * @brief Checks if the container has no records.
+   * @return True if the container is empty, false otherwise.
+   */
+  [[nodiscard]] bool empty() const noexcept { return storage_.Size() == 0; }
+
+  /**
+   * @brief Gets the number of records both arrays can hold without reallocating.
+   * @return The capacity of the container.
+   */
+  [[nodiscard]] size_type capacity() const noexcept { return storage_.Capacity(); }
+
+  /**
+   * @brief Reserves storage for at least capacity records in both arrays.
+   * @param capacity The number of records to reserve.
+   */
+  void reserve(size_type capacity) { storage_.Reserve(capacity); }
+
+  /**
+   * @brief Resizes both arrays to count records, value-initializing new fields.
+   * @param count The new number of records.
+   */
+  void resize(size_type count) { storage_.Resize(count); }
+
+  /**
+   * @brief Removes all records.
+   */
+  void clear() noexcept { storage_.Clear(); }
+
+  /**
+   * @brief Appends an object, splitting its data members between the two arrays.
+   * @param object The object to append.
+   */
+  void push_back(const T& object) { storage_.PushBack(object); }
+
+  /**
+   * @brief Appends an object, moving its data members into the two arrays.
+   * @param object The object to append.
+   */
+  void push_back(T&& object) { storage_.PushBack(std::move(object)); }
+
+  /**
+   * @brief Removes the last record. The container must not be empty.
+   */
+  void pop_back() noexcept { storage_.PopBack(); }
+
+  /**
+   * @brief Gets a proxy for the record at the given index.
+   * @param index The index of the record.
+   * @return A proxy giving access to the fields of the record.
+   */
+  [[nodiscard]] reference operator[](size_type index) noexcept { return reference(*this, index); }
+
+  /**
+   * @brief Gets a read-only proxy for the record at the given index.
+   * @param index The index of the record.
+   * @return A proxy giving read-only access to the fields of the record.
+   */
+  [[nodiscard]] const_reference operator[](size_type index) const noexcept { return const_reference(*this, index); }
+
+private:
+  internal_storage storage_;
+};
+
+}  // namespace ctti
@@ -71,6 +71,27 @@ public:
     return internal_type::template HasTag<Tag>();
   }
 
+  /**
+   * @brief Checks if the symbol has a key/value attribute with the specified key.
+   * @tparam Key The key to check for.
+   * @return true if the symbol has a kv attribute with the key, false otherwise.
+   */
+  template <detail::CompileTimeString Key>
+  [[nodiscard]] static constexpr bool has_key() noexcept {
+    return internal_type::template HasKey<Key>();
+  }
+
+  /**
+   * @brief Gets the value of the key/value attribute with the specified key.
+   * @tparam Key The key of the value, which the symbol must have.
+   * @return The value of the first kv attribute with the key.
+   */
+  template <detail::CompileTimeString Key>
+    requires(internal_type::template HasKey<Key>())
+  [[nodiscard]] static constexpr auto get_key_value() noexcept {
+    return internal_type::template GetKeyValue<Key>();
+  }
+
   /**
    * @brief Checks if the symbol has an overload that matches the specified argument types.
    * @tparam Args The argument types to check for.
@@ -129,6 +150,36 @@ public:
       noexcept(internal_type::SetValue(std::forward<T>(obj), std::forward<Value>(value)))) {
     internal_type::SetValue(std::forward<T>(obj), std::forward<Value>(value));
   }
+
+  /**
+   * @brief Gets the value of the member from a record proxy, such as split_storage<T>::reference.
+   * @tparam Proxy The type of the proxy, whose record_type the symbol belongs to.
+   * @param proxy The proxy for the record.
+   * @return A reference to the field, const if the proxy is read-only.
+   */
+  template <typename Proxy>
+    requires(detail::RecordProxyWith<Proxy, internal_type::kNameLiteral> &&
+             internal_type::template IsOwnerOf<typename Proxy::record_type>())
+  [[nodiscard]] static constexpr decltype(auto) get_value(const Proxy& proxy) noexcept {
+    return proxy.template get<internal_type::kNameLiteral>();
+  }
+
+  /**
+   * @brief Sets the value of the member in the record a proxy stands for.
+   * @tparam Proxy The type of the proxy, whose record_type the symbol belongs to.
+   * @tparam Value The type of the value to set.
+   * @param proxy The proxy for the record.
+   * @param value The value to set.
+   */
+  template <typename Proxy, typename Value>
+    requires(detail::RecordProxyWith<Proxy, internal_type::kNameLiteral> &&
+             internal_type::template IsOwnerOf<typename Proxy::record_type>() &&
+             requires(const Proxy& proxy, Value&& value) {
+               proxy.template set<internal_type::kNameLiteral>(std::forward<Value>(value));
+             })
+  static constexpr void set_value(const Proxy& proxy, Value&& value) {
+    proxy.template set<internal_type::kNameLiteral>(std::forward<Value>(value));
+  }
 };
 
 template <detail::CompileTimeString Name>
@@ -344,4 +395,60 @@ template <detail::CompileTimeString Name, typename T>
   return symbol.hash;
 }
 
+/**
+ * @brief Checks if a symbol has a key/value attribute with the specified key.
+ * @tparam Key The key to check for.
+ * @tparam InternalSymbol The internal type of the symbol.
+ * @param symbol The symbol, such as one passed to a for_each_symbol callback.
+ * @return true if the symbol has a kv attribute with the key, false otherwise.
+ */
+template <detail::CompileTimeString Key, typename InternalSymbol>
+[[nodiscard]] constexpr bool attribute_has(symbol<InternalSymbol> /*symbol*/) noexcept {
+  return symbol<InternalSymbol>::template has_key<Key>();
+}
+
+/**
+ * @brief Gets the value of the key/value attribute of a symbol with the specified key.
+ * @details Resolved at compile time, so the value can drive generated code such as a serializer's field numbers.
+ * @tparam Key The key of the value, which the symbol must have.
+ * @tparam InternalSymbol The internal type of the symbol.
+ * @param symbol The symbol, such as one passed to a for_each_symbol callback.
+ * @return The value of the first kv attribute with the key.
+ *
+ * @example
+ * @code
+ * ctti::for_each_symbol<Order>([&](auto symbol) {
+ *   if constexpr (ctti::attribute_has<"field">(symbol)) {
+ *     constexpr int kFieldNumber = ctti::attribute_get<"field">(symbol);
+ *     write_tag(out, kFieldNumber);
+ *   }
+ * });
+ * @endcode
+ */
+template <detail::CompileTimeString Key, typename InternalSymbol>
+  requires(symbol<InternalSymbol>::template has_key<Key>())
+[[nodiscard]] constexpr auto attribute_get(symbol<InternalSymbol> /*symbol*/) noexcept {
+  return symbol<InternalSymbol>::template get_key_value<Key>();
+}
+
+/**
+ * @brief Gets the value of the key/value attribute of a symbol with the specified key, or a fallback.
+ * @details The result has the type of the fallback either way, so that code using it does not depend on whether the
+ * symbol has the key.
+ * @tparam Key The key of the value.
+ * @tparam InternalSymbol The internal type of the symbol.
+ * @tparam Fallback The type of the fallback, which the value must be convertible to.
+ * @param symbol The symbol, such as one passed to a for_each_symbol callback.
+ * @param fallback The value to return if the symbol has no kv attribute with the key.
+ * @return The value of the first kv attribute with the key converted to Fallback, or the fallback.
+ */
+template <detail::CompileTimeString Key, typename InternalSymbol, typename Fallback>
+[[nodiscard]] constexpr Fallback attribute_get_or(symbol<InternalSymbol> /*symbol*/, Fallback fallback) noexcept {
+  if constexpr (symbol<InternalSymbol>::template has_key<Key>()) {
+    return static_cast<Fallback>(symbol<InternalSymbol>::template get_key_value<Key>());
+  } else {
+    return fallback;
+  }
+}
+
 }  // namespace ctti
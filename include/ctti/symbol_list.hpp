@@ -0,0 +1,100 @@
+#pragma once
+
+#include <ctti/detail/meta.hpp>
+#include <ctti/detail/symbol_list_impl.hpp>
+#include <ctti/reflection.hpp>
+#include <ctti/symbol.hpp>
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+
+namespace ctti {
+
+/**
+ * @brief A compile-time list of symbols, such as the symbols of a type that carry a given attribute.
+ * @tparam Symbols The symbol types in the list.
+ */
+template <typename... Symbols>
+struct symbol_list {
+  static constexpr std::size_t size = sizeof...(Symbols);
+
+  template <std::size_t I>
+    requires(I < size)
+  using at = std::tuple_element_t<I, std::tuple<Symbols...>>;
+
+  /**
+   * @brief Retrieves the names of the symbols in the list.
+   * @return An array of string views holding the name of each symbol, in list order.
+   */
+  [[nodiscard]] static constexpr auto names() noexcept -> std::array<std::string_view, size> {
+    return {Symbols::name...};
+  }
+
+  /**
+   * @brief Applies a given function to each symbol in the list.
+   * @details Only the symbols in the list are passed to the function, so its body is only instantiated for them.
+   * @tparam F The type of the function to apply.
+   * @param func The function to apply to each symbol.
+   */
+  template <typename F>
+    requires(std::invocable<const F&, Symbols> && ...)
+  static constexpr void for_each(const F& func) noexcept((std::is_nothrow_invocable_v<const F&, Symbols> && ...)) {
+    (func(Symbols{}), ...);
+  }
+};
+
+namespace detail {
+
+template <typename DefinitionList>
+struct SymbolListFromDefinitions;
+
+template <typename... Definitions>
+struct SymbolListFromDefinitions<TypeList<Definitions...>> {
+  using type = symbol_list<symbol<typename Definitions::SymbolType>...>;
+};
+
+}  // namespace detail
+
+/**
+ * @brief Retrieves the symbols of a type that carry every one of the given attributes.
+ * @details The symbols are selected at compile time, in reflection order. Iterating over the result only
+ * instantiates the function for the matching symbols, unlike checking has_attribute inside for_each_symbol.
+ * @tparam T The reflectable type.
+ * @tparam Attributes The attributes a symbol must carry, such as ctti::validated or ctti::since<2>.
+ * @return A symbol_list of the matching symbols.
+ *
+ * @example
+ * @code
+ * ctti::symbols_with<Account, ctti::validated>().for_each([&](auto symbol) { check(symbol.get_value(account)); });
+ * @endcode
+ */
+template <reflectable T, typename... Attributes>
+[[nodiscard]] consteval auto symbols_with() noexcept {
+  return typename detail::SymbolListFromDefinitions<detail::DefinitionsWithType<T, Attributes...>>::type{};
+}
+
+/**
+ * @brief Retrieves the symbols of a type that carry none of the given attributes.
+ * @details The counterpart of symbols_with, for skipping symbols such as ctti::internal or ctti::deprecated ones
+ * without generating code for them.
+ * @tparam T The reflectable type.
+ * @tparam Attributes The attributes a symbol must not carry.
+ * @return A symbol_list of the matching symbols.
+ *
+ * @example
+ * @code
+ * ctti::symbols_without<Account, ctti::internal, ctti::deprecated>().for_each([&](auto symbol) {
+ *   out << symbol.name << '\n';
+ * });
+ * @endcode
+ */
+template <reflectable T, typename... Attributes>
+[[nodiscard]] consteval auto symbols_without() noexcept {
+  return typename detail::SymbolListFromDefinitions<detail::DefinitionsWithoutType<T, Attributes...>>::type{};
+}
+
+}  // namespace ctti
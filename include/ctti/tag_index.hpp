@@ -0,0 +1,121 @@
+#pragma once
+
+#include <ctti/attributes.hpp>
+#include <ctti/detail/tag_index_impl.hpp>
+#include <ctti/reflection.hpp>
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+
+namespace ctti {
+
+/**
+ * @brief The set of tags a tag_index records, one bit per tag in the given order.
+ * @tparam Tags The tag types, at most 64 and all distinct.
+ */
+template <typename... Tags>
+  requires(sizeof...(Tags) <= detail::kMaxTagCount)
+struct tag_universe {
+  static constexpr std::size_t size = sizeof...(Tags);
+
+  /**
+   * @brief Checks if a tag belongs to the universe.
+   * @tparam Tag The tag type to check.
+   * @return true if Tag is one of the tags of the universe, false otherwise.
+   */
+  template <typename Tag>
+  [[nodiscard]] static constexpr bool contains() noexcept {
+    return (std::same_as<Tag, Tags> || ...);
+  }
+
+  /**
+   * @brief Builds the mask of a set of tags, for queries against a tag_index.
+   * @tparam Query The tag types to set, which must belong to the universe.
+   * @return The mask with the bit of every queried tag set.
+   */
+  template <typename... Query>
+    requires(contains<Query>() && ...)
+  [[nodiscard]] static constexpr std::uint64_t mask() noexcept {
+    return (std::uint64_t{0} | ... | detail::TagBit<Query, Tags...>());
+  }
+};
+
+/// The built-in tags: read_only, write_only, deprecated, internal and validated.
+using builtin_tags = tag_universe<read_only_tag, write_only_tag, deprecated_tag, internal_tag, validated_tag>;
+
+/**
+ * @brief Precomputed tag bitmasks for the symbols of a type, for tag queries on symbols only known at runtime.
+ * @details Every symbol gets a mask with one bit per tag of the universe, computed once at compile time. Once a
+ * symbol index is known, for example from index_of, a tag query is a single AND with a mask from
+ * Universe::mask, with no template instantiation per symbol. Symbols are indexed in reflection order.
+ * @tparam T The reflectable type.
+ * @tparam Universe The tag_universe whose tags the masks cover, builtin_tags by default.
+ *
+ * @example
+ * @code
+ * using index = ctti::tag_index<Account>;
+ * constexpr auto kHidden = ctti::builtin_tags::mask<ctti::internal_tag, ctti::deprecated_tag>();
+ * if (const auto symbol = index::index_of(requested_field); symbol && !index::has_any(*symbol, kHidden)) {
+ *   expose(*symbol);
+ * }
+ * @endcode
+ */
+template <reflectable T, typename Universe = builtin_tags>
+class tag_index;
+
+template <reflectable T, typename... Tags>
+class tag_index<T, tag_universe<Tags...>> {
+private:
+  using internal_masks = detail::SymbolTagMasks<typename detail::ReflectionOf<T>::DefinitionsType, Tags...>;
+
+public:
+  using universe = tag_universe<Tags...>;
+
+  static constexpr std::size_t size = internal_masks::kCount;
+
+  /// The tag mask of every symbol, in reflection order.
+  static constexpr const std::array<std::uint64_t, size>& masks = internal_masks::kMasks;
+
+  /**
+   * @brief Finds the index of a symbol by name through a perfect hash.
+   * @param name The name of the symbol.
+   * @return The index of the symbol in reflection order, or std::nullopt if T has no symbol with that name.
+   */
+  [[nodiscard]] static constexpr std::optional<std::size_t> index_of(std::string_view name) noexcept {
+    const std::size_t index = internal_masks::kIndex.Find(name);
+    return index < size ? std::optional<std::size_t>(index) : std::nullopt;
+  }
+
+  /**
+   * @brief Gets the tag mask of a symbol.
+   * @param index The index of the symbol, which must be less than size.
+   * @return The mask with the bit of every tag the symbol carries set.
+   */
+  [[nodiscard]] static constexpr std::uint64_t mask_of(std::size_t index) noexcept { return masks[index]; }
+
+  /**
+   * @brief Checks if a symbol carries every tag of a mask.
+   * @param index The index of the symbol, which must be less than size.
+   * @param mask The tags to check, built with universe::mask.
+   * @return true if the symbol carries all the tags, false otherwise.
+   */
+  [[nodiscard]] static constexpr bool has_all(std::size_t index, std::uint64_t mask) noexcept {
+    return (masks[index] & mask) == mask;
+  }
+
+  /**
+   * @brief Checks if a symbol carries at least one tag of a mask.
+   * @param index The index of the symbol, which must be less than size.
+   * @param mask The tags to check, built with universe::mask.
+   * @return true if the symbol carries any of the tags, false otherwise.
+   */
+  [[nodiscard]] static constexpr bool has_any(std::size_t index, std::uint64_t mask) noexcept {
+    return (masks[index] & mask) != 0;
+  }
+};
+
+}  // namespace ctti
@@ -0,0 +1,185 @@
+#pragma once
+
+#include <ctti/attributes.hpp>
+#include <ctti/detail/validate_impl.hpp>
+#include <ctti/reflection.hpp>
+#include <ctti/soa_vector.hpp>
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace ctti {
+
+/**
+ * @brief Describes the first constraint an object breaks.
+ */
+struct validation_error {
+  /// The name of the data member that breaks the constraint.
+  std::string_view field;
+  /// The name of the constraint, such as "range", "non_empty" or "max_length".
+  std::string_view constraint;
+};
+
+/**
+ * @brief Checks an object against the range, non_empty and max_length attributes of its data members.
+ * @details The checks are generated at compile time from the attributes, in reflection order, and data members of
+ * reflectable types are checked recursively. Data members without constraints cost nothing.
+ * @tparam T The reflectable type of the object.
+ * @param object The object to check.
+ * @return The first broken constraint, or std::nullopt if the object satisfies all of them.
+ *
+ * @example
+ * @code
+ * if (const auto error = ctti::validate(order)) {
+ *   reject(order, error->field);
+ * }
+ * @endcode
+ */
+template <reflectable T>
+[[nodiscard]] constexpr std::optional<validation_error> validate(const T& object) {
+  detail::ValidationFailure failure;
+  if (detail::ValidateObject(object, failure)) {
+    return std::nullopt;
+  }
+  return validation_error{failure.field, failure.constraint};
+}
+
+/**
+ * @brief One bit per row, set for the rows that break a constraint.
+ */
+class validation_bitmap {
+public:
+  /**
+   * @brief Constructs a bitmap over a number of rows.
+   * @param rows The number of rows.
+   * @param words The bits, with row i at bit i % 64 of word i / 64.
+   */
+  validation_bitmap(std::size_t rows, std::vector<std::uint64_t> words) noexcept
+      : rows_(rows), words_(std::move(words)) {}
+
+  /**
+   * @brief Gets the number of rows the bitmap covers.
+   * @return The number of rows.
+   */
+  [[nodiscard]] std::size_t size() const noexcept { return rows_; }
+
+  /**
+   * @brief Checks if a row breaks a constraint.
+   * @param row The index of the row, which must be less than size().
+   * @return True if the row is invalid, false otherwise.
+   */
+  [[nodiscard]] bool failed(std::size_t row) const noexcept {
+    return ((words_[row / detail::kBitmapWordBits] >> (row % detail::kBitmapWordBits)) & 1) != 0;
+  }
+
+  /**
+   * @brief Counts the rows that break a constraint.
+   * @return The number of invalid rows.
+   */
+  [[nodiscard]] std::size_t failure_count() const noexcept {
+    std::size_t count = 0;
+    for (const std::uint64_t word : words_) {
+      count += static_cast<std::size_t>(std::popcount(word));
+    }
+    return count;
+  }
+
+  /**
+   * @brief Checks if every row is valid.
+   * @return True if no row breaks a constraint, false otherwise.
+   */
+  [[nodiscard]] bool all_valid() const noexcept {
+    for (const std::uint64_t word : words_) {
+      if (word != 0) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  /**
+   * @brief Gets the words of the bitmap, with row i at bit i % 64 of word i / 64.
+   * @return The words.
+   */
+  [[nodiscard]] std::span<const std::uint64_t> words() const noexcept { return words_; }
+
+private:
+  std::size_t rows_;
+  std::vector<std::uint64_t> words_;
+};
+
+/**
+ * @brief Checks every row of a soa_vector against the constraints of T, one column at a time.
+ * @details Range constraints run over the contiguous column in blocks of 64 rows, each block turned into one word of
+ * the bitmap with branch-free compares that the compiler can vectorize. Other constraints are checked row by row
+ * within their column, and columns of reflectable types are checked with validate.
+ * @tparam T The reflectable type of the rows.
+ * @param rows The rows to check.
+ * @return The bitmap of the rows that break at least one constraint.
+ *
+ * @example
+ * @code
+ * const auto invalid = ctti::validate_columns(ticks);
+ * std::cout << invalid.failure_count() << " rejected\n";
+ * @endcode
+ */
+template <reflectable T>
+[[nodiscard]] validation_bitmap validate_columns(const soa_vector<T>& rows) {
+  const std::size_t count = rows.size();
+  std::vector<std::uint64_t> words((count + detail::kBitmapWordBits - 1) / detail::kBitmapWordBits, 0);
+  []<typename... Definitions>(const soa_vector<T>& columns, std::size_t size, std::span<std::uint64_t> bits,
+                              detail::TypeList<Definitions...>) {
+    ([&] {
+      const auto column = columns.template column<detail::DefinitionNameOf<Definitions>::kValue>();
+      const auto get = [column](std::size_t row) -> const auto& { return column[row]; };
+      detail::MarkColumnFailures(size, get, typename Definitions::AttributesType{}, bits);
+      if constexpr (reflectable<detail::DefinitionValueType<Definitions>>) {
+        for (std::size_t row = 0; row < size; ++row) {
+          if (validate(column[row])) {
+            bits[row / detail::kBitmapWordBits] |= std::uint64_t{1} << (row % detail::kBitmapWordBits);
+          }
+        }
+      }
+    }(), ...);
+  }(rows, count, words, detail::DataMemberDefinitionsOf<T>{});
+  return validation_bitmap(count, std::move(words));
+}
+
+/**
+ * @brief Checks every object of a span against the constraints of T, one data member at a time.
+ * @details Works like the soa_vector overload, with strided instead of contiguous loads.
+ * @tparam T The reflectable type of the objects.
+ * @param objects The objects to check.
+ * @return The bitmap of the objects that break at least one constraint.
+ */
+template <reflectable T>
+[[nodiscard]] validation_bitmap validate_columns(std::span<const T> objects) {
+  const std::size_t count = objects.size();
+  std::vector<std::uint64_t> words((count + detail::kBitmapWordBits - 1) / detail::kBitmapWordBits, 0);
+  []<typename... Definitions>(std::span<const T> rows, std::span<std::uint64_t> bits,
+                              detail::TypeList<Definitions...>) {
+    ([&] {
+      const auto get = [rows](std::size_t row) -> const auto& {
+        return Definitions::SymbolType::GetValue(rows[row]);
+      };
+      detail::MarkColumnFailures(rows.size(), get, typename Definitions::AttributesType{}, bits);
+      if constexpr (reflectable<detail::DefinitionValueType<Definitions>>) {
+        for (std::size_t row = 0; row < rows.size(); ++row) {
+          if (validate(get(row))) {
+            bits[row / detail::kBitmapWordBits] |= std::uint64_t{1} << (row % detail::kBitmapWordBits);
+          }
+        }
+      }
+    }(), ...);
+  }(objects, words, detail::DataMemberDefinitionsOf<T>{});
+  return validation_bitmap(count, std::move(words));
+}
+
+}  // namespace ctti
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <ctti/detail/compile_time_string.hpp>
+#include <ctti/detail/reflection_impl.hpp>
+#include <ctti/detail/view_impl.hpp>
+#include <ctti/reflection.hpp>
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <span>
+#include <type_traits>
+
+namespace ctti {
+
+/**
+ * @brief Concept that checks if a reflectable type can be read in place from a byte buffer.
+ * @details T must have a standard layout, and every data member must be trivially copyable or be a viewable type
+ * itself. C arrays are not viewable, since they cannot be returned by value; std::array is. When Order is not the
+ * native byte order, the trivially copyable data members must be arithmetic values, enums or std::arrays of them,
+ * possibly nested, so that their bytes can be reversed.
+ * @tparam T The type to check.
+ * @tparam Order The byte order of the buffer.
+ */
+template <typename T, std::endian Order = std::endian::native>
+concept viewable = reflectable<T> && detail::IsViewable<T, Order>::value;
+
+/**
+ * @brief A typed, read-only view of an object stored in a byte buffer.
+ * @details Data members are read on demand from their offset in T, through memcpy, so the buffer needs no particular
+ * alignment and only the data members that are accessed are ever loaded. Data members of reflectable types are
+ * returned as views themselves. Offsets are computed once per type.
+ * @tparam T The viewable type stored in the buffer.
+ * @tparam Order The byte order of the buffer. Values are converted to the native byte order when they are loaded.
+ *
+ * @example
+ * @code
+ * for (std::size_t offset = 0; offset + sizeof(Trade) <= log.size(); offset += sizeof(Trade)) {
+ *   ctti::view<Trade> trade(log.subspan(offset, sizeof(Trade)));
+ *   if (trade.get<"symbol_id">() == wanted) {
+ *     volume += trade.get<"quantity">();
+ *   }
+ * }
+ * @endcode
+ */
+template <reflectable T, std::endian Order = std::endian::native>
+  requires viewable<T, Order>
+class view {
+private:
+  using definitions = detail::DataMemberDefinitionsOf<T>;
+
+  template <detail::CompileTimeString Name>
+  static constexpr std::size_t field_index = detail::kDefinitionIndex<Name, definitions>;
+
+public:
+  /// The type stored in the buffer.
+  using value_type = T;
+
+  /// Byte order of the buffer.
+  static constexpr std::endian byte_order = Order;
+
+  /// Number of bytes the view covers.
+  static constexpr std::size_t extent = sizeof(T);
+
+  /**
+   * @brief Constructs a view over the start of a byte buffer.
+   * @param bytes The buffer, which must hold at least sizeof(T) bytes and outlive the view.
+   */
+  explicit view(std::span<const std::byte> bytes) noexcept
+      : data_(bytes.data()), offsets_(&detail::ViewOffsetsOf<T>::Get()) {}
+
+  /**
+   * @brief Reads the data member with the given name.
+   * @tparam Name The compile-time string representing the name of the data member.
+   * @return The value of the data member in the native byte order, or a view of it if its type is reflectable.
+   */
+  template <detail::CompileTimeString Name>
+    requires(field_index<Name> < definitions::kSize)
+  [[nodiscard]] auto get() const noexcept {
+    using field_type = detail::DefinitionValueType<typename definitions::template At<field_index<Name>>>;
+    const std::byte* field = data_ + (*offsets_)[field_index<Name>];
+    if constexpr (reflectable<field_type>) {
+      return view<field_type, Order>(std::span<const std::byte>(field, sizeof(field_type)));
+    } else {
+      return detail::LoadValue<field_type, Order>(field);
+    }
+  }
+
+  /**
+   * @brief Gets the bytes the view covers.
+   * @return The span of sizeof(T) bytes the view reads from.
+   */
+  [[nodiscard]] std::span<const std::byte, extent> bytes() const noexcept {
+    return std::span<const std::byte, extent>(data_, extent);
+  }
+
+private:
+  const std::byte* data_;
+  const std::array<std::size_t, definitions::kSize>* offsets_;
+};
+
+}  // namespace ctti
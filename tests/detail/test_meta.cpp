@@ -186,6 +186,17 @@ TEST_SUITE("detail::meta") {
     CHECK(std::same_as<concatenated::At<3>, bool>);
   }
 
+  TEST_CASE("filter") {
+    using list = ctti::detail::TypeList<int, double, char, float>;
+    using integrals = ctti::detail::FilterType<is_integral_predicate, list>;
+    using floats = ctti::detail::FilterType<is_floating_point_predicate, list>;
+    using none = ctti::detail::FilterType<is_integral_predicate, ctti::detail::TypeList<double>>;
+
+    CHECK(std::same_as<integrals, ctti::detail::TypeList<int, char>>);
+    CHECK(std::same_as<floats, ctti::detail::TypeList<double, float>>);
+    CHECK(std::same_as<none, ctti::detail::TypeList<>>);
+  }
+
   TEST_CASE("contains") {
     using list = ctti::detail::TypeList<int, double, std::string>;
 
@@ -0,0 +1,70 @@
+#include "doctest.h"
+
+#include <ctti/detail/perfect_hash.hpp>
+
+#include <array>
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+namespace {
+
+constexpr std::array<std::string_view, 6> kKeys = {"id", "name", "pose.position.x", "pose.position.y", "battery",
+                                                   "a"};
+
+constexpr std::size_t kManyCount = 200;
+
+constexpr auto kManyStorage = [] {
+  std::array<char, kManyCount * 3> storage = {};
+  for (std::size_t i = 0; i < kManyCount; ++i) {
+    storage[i * 3] = static_cast<char>('a' + i / 100);
+    storage[i * 3 + 1] = static_cast<char>('0' + i / 10 % 10);
+    storage[i * 3 + 2] = static_cast<char>('0' + i % 10);
+  }
+  return storage;
+}();
+
+constexpr auto kManyKeys = [] {
+  std::array<std::string_view, kManyCount> keys = {};
+  for (std::size_t i = 0; i < kManyCount; ++i) {
+    keys[i] = std::string_view(kManyStorage.data() + i * 3, 3);
+  }
+  return keys;
+}();
+
+}  // namespace
+
+TEST_SUITE("detail::perfect_hash") {
+  TEST_CASE("finds_every_key") {
+    constexpr ctti::detail::PerfectHashIndex<kKeys.size()> index{kKeys};
+
+    static_assert(index.Find("id") == 0);
+    static_assert(index.Find("battery") == 4);
+    for (std::size_t i = 0; i < kKeys.size(); ++i) {
+      CHECK_EQ(index.Find(kKeys[i]), i);
+    }
+  }
+
+  TEST_CASE("rejects_unknown_keys") {
+    constexpr ctti::detail::PerfectHashIndex<kKeys.size()> index{kKeys};
+
+    static_assert(index.Find("unknown") == kKeys.size());
+    CHECK_EQ(index.Find(""), kKeys.size());
+    CHECK_EQ(index.Find("pose.position"), kKeys.size());
+    CHECK_EQ(index.Find(std::string("name")), 1);
+  }
+
+  TEST_CASE("many_similar_keys") {
+    static constexpr ctti::detail::PerfectHashIndex<kManyCount> index{kManyKeys};
+
+    for (std::size_t i = 0; i < kManyCount; ++i) {
+      CHECK_EQ(index.Find(kManyKeys[i]), i);
+    }
+    CHECK_EQ(index.Find("z99"), kManyCount);
+  }
+
+  TEST_CASE("empty") {
+    constexpr ctti::detail::PerfectHashIndex<0> index{std::array<std::string_view, 0>{}};
+    static_assert(index.Find("anything") == 0);
+  }
+}
@@ -0,0 +1,222 @@
+#include "doctest.h"
+
+#include <ctti/aggregate.hpp>
+#include <ctti/compare.hpp>
+#include <ctti/map.hpp>
+#include <ctti/reflected_hash.hpp>
+#include <ctti/reflection.hpp>
+#include <ctti/soa_vector.hpp>
+#include <ctti/tie.hpp>
+
+#include <array>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+struct Order {
+  std::uint64_t id = 0;
+  double price = 0.0;
+  std::string symbol;
+  std::array<int, 3> levels = {};
+};
+
+struct Inner {
+  int a = 0;
+  int b = 0;
+};
+
+struct Outer {
+  Inner inner;
+  const char* label = nullptr;
+};
+
+struct Wide {
+  int f00, f01, f02, f03, f04, f05, f06, f07, f08, f09;
+  int f10, f11, f12, f13, f14, f15, f16, f17, f18, f19;
+  int f20, f21, f22, f23, f24, f25, f26, f27, f28, f29;
+  int f30, f31, f32, f33, f34, f35, f36, f37, f38, f39;
+};
+
+struct NotOptedIn {
+  int x = 0;
+};
+
+struct Bounds {
+  int lo = 0;
+  int hi = 0;
+};
+
+struct Tagged {};
+
+struct WithBase : Inner {
+  int c = 0;
+};
+
+struct WithEmptyBase : Tagged {
+  int value = 0;
+};
+
+struct WithArray {
+  int values[3];
+  int count;
+};
+
+struct WithReference {
+  int id;
+  int& target;
+};
+
+struct WithConstReference {
+  int id;
+  const int& target;
+};
+
+struct WithBitField {
+  unsigned flags : 4;
+  unsigned mode : 4;
+};
+
+class NotAggregate {
+public:
+  explicit NotAggregate(int value) : value_(value) {}
+
+private:
+  int value_;
+};
+
+}  // namespace
+
+template <>
+struct ctti::meta<Order> : ctti::aggregate_meta<Order> {};
+
+template <>
+struct ctti::meta<Inner> : ctti::aggregate_meta<Inner> {};
+
+template <>
+struct ctti::meta<Outer> : ctti::aggregate_meta<Outer> {};
+
+template <>
+struct ctti::meta<Bounds> : ctti::aggregate_meta<Bounds> {};
+
+template <>
+struct ctti::meta<Wide> : ctti::aggregate_meta<Wide> {};
+
+TEST_SUITE("aggregate") {
+  TEST_CASE("field_count") {
+    static_assert(ctti::aggregate_field_count<Order> == 4);
+    static_assert(ctti::aggregate_field_count<Inner> == 2);
+    static_assert(ctti::aggregate_field_count<Outer> == 2);
+    static_assert(ctti::aggregate_field_count<Wide> == 40);
+
+    static_assert(ctti::aggregate_reflectable<NotOptedIn>);
+    static_assert(!ctti::aggregate_reflectable<NotAggregate>);
+    static_assert(!ctti::aggregate_reflectable<int>);
+    static_assert(!ctti::aggregate_reflectable<WithBase>);
+    static_assert(!ctti::aggregate_reflectable<WithEmptyBase>);
+    static_assert(!ctti::aggregate_reflectable<WithArray>);
+    static_assert(!ctti::aggregate_reflectable<WithReference>);
+    static_assert(!ctti::aggregate_reflectable<WithConstReference>);
+    static_assert(!ctti::aggregate_reflectable<WithBitField>);
+  }
+
+  TEST_CASE("opt_in") {
+    CHECK(ctti::reflectable<Order>);
+    CHECK_FALSE(ctti::reflectable<NotOptedIn>);
+  }
+
+  TEST_CASE("field_names") {
+    constexpr auto names = ctti::get_symbol_names<Order>();
+    static_assert(names.size() == 4);
+    static_assert(names[0] == "id");
+    static_assert(names[1] == "price");
+    static_assert(names[2] == "symbol");
+    static_assert(names[3] == "levels");
+
+    static_assert(ctti::get_symbol_names<Wide>()[39] == "f39");
+    static_assert(ctti::get_reflection<Order>().has_symbol<"price">());
+  }
+
+  TEST_CASE("get_and_set_values") {
+    Order order{42, 1.5, "ACME", {1, 2, 3}};
+
+    constexpr auto symbol = ctti::get_symbol<Order, "symbol">();
+    CHECK_EQ(symbol.get_value(order), "ACME");
+
+    ctti::get_symbol<Order, "price">().set_value(order, 2.5);
+    CHECK_EQ(order.price, 2.5);
+
+    const Order& view = order;
+    CHECK_EQ(ctti::get_symbol<Order, "id">().get_value(view), 42);
+  }
+
+  TEST_CASE("for_each_symbol") {
+    Outer outer{{1, 2}, "outer"};
+
+    int visited = 0;
+    ctti::for_each_symbol<Outer>([&](auto symbol) {
+      if constexpr (symbol.name == "inner") {
+        CHECK_EQ(symbol.get_value(outer).b, 2);
+      }
+      ++visited;
+    });
+    CHECK_EQ(visited, 2);
+  }
+
+  TEST_CASE("works_with_reflection_features") {
+    ctti::soa_vector<Order> orders;
+    orders.push_back(Order{1, 10.0, "A", {}});
+    orders.push_back(Order{2, 20.0, "B", {}});
+    CHECK_EQ(orders.column<"price">()[1], 20.0);
+
+    CHECK(ctti::reflected_equal<Inner>{}(Inner{1, 2}, Inner{1, 2}));
+    CHECK(ctti::reflected_less<Inner>{}(Inner{1, 2}, Inner{1, 3}));
+    CHECK_EQ(ctti::hash_value(Inner{1, 2}), ctti::hash_value(Inner{1, 2}));
+  }
+
+  TEST_CASE("map") {
+    constexpr auto inner_a = ctti::get_symbol<Inner, "a">();
+    constexpr auto inner_b = ctti::get_symbol<Inner, "b">();
+    constexpr auto bounds_lo = ctti::get_symbol<Bounds, "lo">();
+    constexpr auto bounds_hi = ctti::get_symbol<Bounds, "hi">();
+
+    Bounds bounds;
+    ctti::map(Inner{3, 7}, bounds, ctti::make_mapping<inner_a, bounds_lo>(), ctti::make_mapping<inner_b, bounds_hi>());
+    CHECK_EQ(bounds.lo, 3);
+    CHECK_EQ(bounds.hi, 7);
+
+    constexpr auto symbol = ctti::get_symbol<Order, "symbol">();
+    Order source{1, 10.0, std::string(64, 'x'), {}};
+    Order sink;
+    ctti::map(std::move(source), sink, ctti::make_mapping<symbol, symbol>());
+    CHECK_EQ(sink.symbol.size(), 64);
+  }
+
+  TEST_CASE("map_range") {
+    constexpr auto inner_a = ctti::get_symbol<Inner, "a">();
+    constexpr auto inner_b = ctti::get_symbol<Inner, "b">();
+    constexpr auto bounds_lo = ctti::get_symbol<Bounds, "lo">();
+    constexpr auto bounds_hi = ctti::get_symbol<Bounds, "hi">();
+
+    const std::vector<Inner> source = {{1, 2}, {3, 4}, {5, 6}};
+    std::vector<Bounds> sink(source.size());
+    ctti::map_range(std::span<const Inner>(source), std::span<Bounds>(sink),
+                    ctti::make_mapping<inner_a, bounds_lo>(), ctti::make_mapping<inner_b, bounds_hi>());
+    CHECK_EQ(sink[0].lo, 1);
+    CHECK_EQ(sink[2].hi, 6);
+  }
+
+  TEST_CASE("tie") {
+    constexpr auto lo = ctti::get_symbol<Bounds, "lo">();
+    constexpr auto hi = ctti::get_symbol<Bounds, "hi">();
+
+    int low = 0;
+    int high = 0;
+    ctti::tie<lo, hi>(low, high) = Bounds{-1, 1};
+    CHECK_EQ(low, -1);
+    CHECK_EQ(high, 1);
+  }
+}
@@ -1,8 +1,32 @@
 #include "doctest.h"
 
 #include <ctti/attributes.hpp>
+#include <ctti/reflection.hpp>
+#include <ctti/symbol.hpp>
 
 #include <concepts>
+#include <cstddef>
+
+namespace {
+
+enum class Compression { kNone, kLz4 };
+
+struct WireRecord {
+  int id = 0;
+  double price = 0.0;
+  int padding = 0;
+};
+
+}  // namespace
+
+template <>
+struct ctti::meta<WireRecord> {
+  using type = WireRecord;
+  static constexpr auto reflection = ctti::make_reflection(
+      ctti::member<"id", &WireRecord::id>(ctti::kv<"field", 1>{}, ctti::kv<"width", std::size_t{8}>{}),
+      ctti::member<"price", &WireRecord::price>(ctti::kv<"field", 2>{}, ctti::kv<"codec", Compression::kLz4>{}),
+      ctti::member<"padding", &WireRecord::padding>(ctti::internal{}));
+};
 
 TEST_SUITE("attributes") {
   TEST_CASE("attribute_value") {
@@ -58,6 +82,17 @@ TEST_SUITE("attributes") {
     CHECK_FALSE(attr_list::has_value<2>());
   }
 
+  TEST_CASE("parameterized_attributes_are_not_values") {
+    using attr_list = ctti::attribute_list<ctti::compare_order<1>, ctti::max_length<8>, ctti::bits<12>>;
+
+    static_assert(!attr_list::has_value<1>());
+    static_assert(!attr_list::has_value<8>());
+    static_assert(!attr_list::has_value<12>());
+    CHECK_EQ(ctti::compare_order<1>::position, 1);
+    CHECK_EQ(ctti::max_length<8>::length, 8);
+    CHECK_EQ(ctti::bits<12>::width, 12);
+  }
+
   TEST_CASE("attribute_list_for_each") {
     using attr_list = ctti::attribute_list<ctti::read_only, ctti::since<42>>;
 
@@ -65,4 +100,39 @@ TEST_SUITE("attributes") {
     attr_list::for_each([&count](auto identity) { ++count; });
     CHECK_EQ(count, 2);
   }
+
+  TEST_CASE("kv_attribute_list") {
+    using attr_list = ctti::attribute_list<ctti::kv<"field", 3>, ctti::read_only, ctti::kv<"field", 4>>;
+
+    static_assert(attr_list::has_key<"field">());
+    static_assert(!attr_list::has_key<"width">());
+    static_assert(attr_list::get_key_value<"field">() == 3);
+    CHECK_EQ(ctti::kv<"field", 3>::key, "field");
+  }
+
+  TEST_CASE("attribute_get") {
+    constexpr auto id = ctti::get_symbol<WireRecord, "id">();
+    constexpr auto price = ctti::get_symbol<WireRecord, "price">();
+    constexpr auto padding = ctti::get_symbol<WireRecord, "padding">();
+
+    static_assert(ctti::attribute_has<"field">(id));
+    static_assert(!ctti::attribute_has<"field">(padding));
+    static_assert(ctti::attribute_get<"field">(id) == 1);
+    static_assert(ctti::attribute_get<"field">(price) == 2);
+    static_assert(std::same_as<decltype(ctti::attribute_get<"width">(id)), std::size_t>);
+    static_assert(ctti::attribute_get<"codec">(price) == Compression::kLz4);
+    static_assert(ctti::attribute_get_or<"codec">(id, Compression::kNone) == Compression::kNone);
+    static_assert(ctti::attribute_get_or<"field">(id, std::size_t{0}) == 1);
+    static_assert(std::same_as<decltype(ctti::attribute_get_or<"field">(id, std::size_t{0})), std::size_t>);
+    static_assert(std::same_as<decltype(ctti::attribute_get_or<"field">(padding, std::size_t{0})), std::size_t>);
+
+    int field_sum = 0;
+    ctti::for_each_symbol<WireRecord>([&](auto symbol) {
+      if constexpr (ctti::attribute_has<"field">(symbol)) {
+        constexpr int kField = ctti::attribute_get<"field">(symbol);
+        field_sum += kField;
+      }
+    });
+    CHECK_EQ(field_sum, 3);
+  }
 }
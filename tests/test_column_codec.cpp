@@ -0,0 +1,231 @@
+#include "doctest.h"
+
+#include <ctti/column_codec.hpp>
+#include <ctti/enum_utils.hpp>
+#include <ctti/reflection.hpp>
+#include <ctti/serialize.hpp>
+
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace {
+
+enum class Status : std::uint8_t { kOk, kWarning, kError };
+
+enum class Unregistered : std::int16_t { kLow = -5, kHigh = 500 };
+
+struct Reading {
+  std::int64_t timestamp;
+  std::uint16_t sensor;
+  std::int32_t delta;
+};
+
+struct Tick {
+  Reading reading;
+  Status status;
+  Unregistered level;
+  double value;
+  float ratio;
+  bool valid;
+};
+
+struct Labeled {
+  std::string label;
+};
+
+struct Quote {
+  double price;
+  float weight;
+};
+
+}  // namespace
+
+template <>
+struct ctti::enum_values<Status> {
+  static constexpr auto values = ctti::make_enum_list<Status::kOk, Status::kWarning, Status::kError>();
+};
+
+template <>
+struct ctti::meta<Reading> {
+  using type = Reading;
+  static constexpr auto reflection =
+      ctti::make_reflection(ctti::member<"timestamp", &Reading::timestamp>(),
+                            ctti::member<"sensor", &Reading::sensor>(), ctti::member<"delta", &Reading::delta>());
+};
+
+template <>
+struct ctti::meta<Tick> {
+  using type = Tick;
+  static constexpr auto reflection = ctti::make_reflection(
+      ctti::member<"reading", &Tick::reading>(), ctti::member<"status", &Tick::status>(),
+      ctti::member<"level", &Tick::level>(), ctti::member<"value", &Tick::value>(),
+      ctti::member<"ratio", &Tick::ratio>(), ctti::member<"valid", &Tick::valid>());
+};
+
+template <>
+struct ctti::meta<Quote> {
+  using type = Quote;
+  static constexpr auto reflection =
+      ctti::make_reflection(ctti::member<"price", &Quote::price>(), ctti::member<"weight", &Quote::weight>());
+};
+
+template <>
+struct ctti::meta<Labeled> {
+  using type = Labeled;
+  static constexpr auto reflection = ctti::make_reflection(ctti::member<"label", &Labeled::label>());
+};
+
+namespace {
+
+std::vector<Tick> MakeTicks(std::size_t count) {
+  std::vector<Tick> ticks(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    auto& tick = ticks[i];
+    tick.reading = {1'700'000'000'000 + static_cast<std::int64_t>(i) * 1000, static_cast<std::uint16_t>(i % 3),
+                    static_cast<std::int32_t>(i % 5) - 2};
+    tick.status = static_cast<Status>(i % 3);
+    tick.level = i % 2 == 0 ? Unregistered::kLow : Unregistered::kHigh;
+    tick.value = 20.0 + static_cast<double>(i % 10) * 0.5;
+    tick.ratio = 0.5F;
+    tick.valid = i % 4 != 0;
+  }
+  return ticks;
+}
+
+void CheckEqual(const Tick& lhs, const Tick& rhs) {
+  CHECK_EQ(lhs.reading.timestamp, rhs.reading.timestamp);
+  CHECK_EQ(lhs.reading.sensor, rhs.reading.sensor);
+  CHECK_EQ(lhs.reading.delta, rhs.reading.delta);
+  CHECK_EQ(lhs.status, rhs.status);
+  CHECK_EQ(lhs.level, rhs.level);
+  CHECK_EQ(lhs.value, rhs.value);
+  CHECK_EQ(lhs.ratio, rhs.ratio);
+  CHECK_EQ(lhs.valid, rhs.valid);
+}
+
+}  // namespace
+
+TEST_SUITE("column_codec") {
+  TEST_CASE("column_encodable") {
+    static_assert(ctti::column_encodable<Tick>);
+    static_assert(!ctti::column_encodable<Labeled>);
+  }
+
+  TEST_CASE("round_trip_compresses") {
+    const auto ticks = MakeTicks(1000);
+    ctti::byte_writer writer;
+    ctti::encode_columns(std::span<const Tick>(ticks), writer);
+    CHECK_LT(writer.size() * 2, ticks.size() * sizeof(Tick));
+
+    ctti::byte_reader reader(writer.bytes());
+    std::vector<Tick> decoded;
+    REQUIRE(ctti::decode_columns(reader, decoded));
+    CHECK_EQ(reader.remaining(), 0);
+    REQUIRE_EQ(decoded.size(), ticks.size());
+    for (std::size_t i = 0; i < ticks.size(); ++i) {
+      CheckEqual(decoded[i], ticks[i]);
+    }
+  }
+
+  TEST_CASE("extreme_values") {
+    std::vector<Tick> ticks = MakeTicks(4);
+    ticks[1].reading.timestamp = std::numeric_limits<std::int64_t>::min();
+    ticks[2].reading.timestamp = std::numeric_limits<std::int64_t>::max();
+    ticks[1].reading.sensor = std::numeric_limits<std::uint16_t>::max();
+    ticks[2].value = -std::numeric_limits<double>::infinity();
+    ticks[3].status = static_cast<Status>(200);
+
+    ctti::byte_writer writer;
+    ctti::encode_columns(std::span<const Tick>(ticks), writer);
+    ctti::byte_reader reader(writer.bytes());
+    std::vector<Tick> decoded;
+    REQUIRE(ctti::decode_columns(reader, decoded));
+    REQUIRE_EQ(decoded.size(), ticks.size());
+    for (std::size_t i = 0; i < ticks.size(); ++i) {
+      CheckEqual(decoded[i], ticks[i]);
+    }
+  }
+
+  TEST_CASE("decimal_prices") {
+    // A random walk of prices in cents, moving up and down
+    std::vector<Quote> quotes(1000);
+    std::uint32_t state = 12345;
+    std::int64_t cents = 10'000;
+    for (Quote& quote : quotes) {
+      state = state * 1'664'525U + 1'013'904'223U;
+      cents += static_cast<std::int64_t>(state >> 28) - 7;
+      quote = {static_cast<double>(cents) / 100.0, 0.25F};
+    }
+
+    ctti::byte_writer writer;
+    ctti::encode_columns(std::span<const Quote>(quotes), writer);
+    CHECK_LT(writer.size(), quotes.size() * sizeof(double) / 6);
+
+    ctti::byte_reader reader(writer.bytes());
+    std::vector<Quote> decoded;
+    REQUIRE(ctti::decode_columns(reader, decoded));
+    REQUIRE_EQ(decoded.size(), quotes.size());
+    for (std::size_t i = 0; i < quotes.size(); ++i) {
+      CHECK_EQ(std::bit_cast<std::uint64_t>(decoded[i].price), std::bit_cast<std::uint64_t>(quotes[i].price));
+      CHECK_EQ(decoded[i].weight, quotes[i].weight);
+    }
+  }
+
+  TEST_CASE("xor_bits") {
+    std::vector<Quote> quotes(1000);
+    for (std::size_t i = 0; i < quotes.size(); ++i) {
+      const double angle = static_cast<double>(i) * 0.01;
+      quotes[i] = {std::sin(angle), static_cast<float>(std::cos(angle))};
+    }
+    quotes[1].price = -0.0;
+    quotes[2].price = std::numeric_limits<double>::quiet_NaN();
+    quotes[3].price = std::numeric_limits<double>::denorm_min();
+    quotes[4].weight = std::numeric_limits<float>::infinity();
+
+    ctti::byte_writer writer;
+    ctti::encode_columns(std::span<const Quote>(quotes), writer);
+    CHECK_LT(writer.size(), quotes.size() * sizeof(Quote));
+
+    ctti::byte_reader reader(writer.bytes());
+    std::vector<Quote> decoded;
+    REQUIRE(ctti::decode_columns(reader, decoded));
+    REQUIRE_EQ(decoded.size(), quotes.size());
+    for (std::size_t i = 0; i < quotes.size(); ++i) {
+      CHECK_EQ(std::bit_cast<std::uint64_t>(decoded[i].price), std::bit_cast<std::uint64_t>(quotes[i].price));
+      CHECK_EQ(std::bit_cast<std::uint32_t>(decoded[i].weight), std::bit_cast<std::uint32_t>(quotes[i].weight));
+    }
+  }
+
+  TEST_CASE("rejects_malformed_input") {
+    const auto ticks = MakeTicks(10);
+    ctti::byte_writer writer;
+    ctti::encode_columns(std::span<const Tick>(ticks), writer);
+    const auto& bytes = writer.bytes();
+    std::vector<Tick> decoded;
+
+    ctti::byte_reader truncated(std::span<const std::byte>(bytes).first(bytes.size() - 1));
+    CHECK_FALSE(ctti::decode_columns(truncated, decoded));
+
+    auto oversized = bytes;
+    const std::uint64_t count = 1ULL << 40;
+    std::memcpy(oversized.data(), &count, sizeof(count));
+    ctti::byte_reader huge(oversized);
+    CHECK_FALSE(ctti::decode_columns(huge, decoded));
+  }
+
+  TEST_CASE("empty") {
+    ctti::byte_writer writer;
+    ctti::encode_columns(std::span<const Tick>(), writer);
+    ctti::byte_reader reader(writer.bytes());
+    std::vector<Tick> decoded(3);
+    REQUIRE(ctti::decode_columns(reader, decoded));
+    CHECK(decoded.empty());
+  }
+}
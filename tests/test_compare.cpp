@@ -0,0 +1,165 @@
+#include "doctest.h"
+
+#include <ctti/attributes.hpp>
+#include <ctti/compare.hpp>
+#include <ctti/reflection.hpp>
+
+#include <algorithm>
+#include <compare>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace {
+
+struct Version {
+  std::uint8_t major = 0;
+  std::uint8_t minor = 0;
+  std::uint8_t patch = 0;
+  std::string label;
+};
+
+struct Padded {
+  std::uint8_t tag = 0;
+  std::uint64_t value = 0;
+};
+
+struct Dense {
+  std::uint32_t id = 0;
+  std::uint32_t shard = 0;
+};
+
+struct Employee {
+  std::string name;
+  int age = 0;
+  double salary = 0.0;
+};
+
+struct LessOnly {
+  int value = 0;
+
+  bool operator<(const LessOnly& other) const { return value < other.value; }
+  bool operator==(const LessOnly&) const = default;
+};
+
+struct Nested {
+  Version version;
+  LessOnly rank;
+};
+
+}  // namespace
+
+template <>
+struct ctti::meta<Version> {
+  using type = Version;
+
+  static constexpr auto reflection =
+      ctti::make_reflection(ctti::member<"major", &Version::major>(), ctti::member<"minor", &Version::minor>(),
+                            ctti::member<"patch", &Version::patch>(), ctti::member<"label", &Version::label>());
+};
+
+template <>
+struct ctti::meta<Padded> {
+  using type = Padded;
+
+  static constexpr auto reflection =
+      ctti::make_reflection(ctti::member<"tag", &Padded::tag>(), ctti::member<"value", &Padded::value>());
+};
+
+template <>
+struct ctti::meta<Dense> {
+  using type = Dense;
+
+  static constexpr auto reflection =
+      ctti::make_reflection(ctti::member<"id", &Dense::id>(), ctti::member<"shard", &Dense::shard>());
+};
+
+template <>
+struct ctti::meta<Employee> {
+  using type = Employee;
+
+  static constexpr auto reflection = ctti::make_reflection(
+      ctti::member<"name", &Employee::name>(ctti::read_only{}),
+      ctti::member<"age", &Employee::age>(ctti::since<1>{}, ctti::compare_order<1>{}),
+      ctti::member<"salary", &Employee::salary>(ctti::compare_order<0>{}));
+};
+
+template <>
+struct ctti::meta<Nested> {
+  using type = Nested;
+
+  static constexpr auto reflection =
+      ctti::make_reflection(ctti::member<"version", &Nested::version>(), ctti::member<"rank", &Nested::rank>());
+};
+
+TEST_SUITE("compare") {
+  TEST_CASE("equality") {
+    constexpr ctti::reflected_equal<Version> equal;
+
+    CHECK(equal(Version{1, 2, 3, "rc"}, Version{1, 2, 3, "rc"}));
+    CHECK_FALSE(equal(Version{1, 2, 3, "rc"}, Version{1, 2, 4, "rc"}));
+    CHECK_FALSE(equal(Version{1, 2, 3, "rc"}, Version{1, 2, 3, "beta"}));
+  }
+
+  TEST_CASE("equality_ignores_padding") {
+    Padded lhs;
+    Padded rhs;
+    std::memset(static_cast<void*>(&lhs), 0x00, sizeof(lhs));
+    std::memset(static_cast<void*>(&rhs), 0xFF, sizeof(rhs));
+    lhs.tag = rhs.tag = 7;
+    lhs.value = rhs.value = 42;
+
+    CHECK(ctti::reflected_equal<Padded>{}(lhs, rhs));
+  }
+
+  TEST_CASE("bytewise_prefix") {
+    static_assert(ctti::detail::kReflectsObjectRepresentation<Dense>);
+    static_assert(ctti::detail::kBytewisePrefixLength<Version, ctti::detail::IsBytewiseComparableValue> == 3);
+    static_assert(ctti::detail::kBytewisePrefixLength<Version, ctti::detail::IsBytewiseOrderableValue> == 3);
+    static_assert(ctti::detail::kBytewisePrefixLength<Employee, ctti::detail::IsBytewiseComparableValue> == 0);
+
+    CHECK(ctti::reflected_equal<Dense>{}(Dense{1, 2}, Dense{1, 2}));
+    CHECK_FALSE(ctti::reflected_equal<Dense>{}(Dense{1, 2}, Dense{2, 1}));
+  }
+
+  TEST_CASE("lexicographic_order") {
+    constexpr ctti::reflected_compare<Version> compare;
+    static_assert(std::same_as<ctti::reflected_compare_category<Version>, std::strong_ordering>);
+
+    CHECK(std::is_eq(compare(Version{1, 2, 3, ""}, Version{1, 2, 3, ""})));
+    CHECK(std::is_lt(compare(Version{1, 2, 3, ""}, Version{1, 3, 0, ""})));
+    CHECK(std::is_gt(compare(Version{2, 0, 0, ""}, Version{1, 9, 9, ""})));
+    CHECK(std::is_lt(compare(Version{1, 0, 0, "alpha"}, Version{1, 0, 0, "beta"})));
+    CHECK(std::is_gt(compare(Version{1, 0, 200, ""}, Version{1, 0, 3, ""})));
+  }
+
+  TEST_CASE("compare_order_attribute") {
+    static_assert(std::same_as<ctti::reflected_compare_category<Employee>, std::partial_ordering>);
+
+    constexpr ctti::reflected_compare<Employee> compare;
+    CHECK(std::is_lt(compare(Employee{"alice", 40, 100.0}, Employee{"bob", 30, 200.0})));
+    CHECK(std::is_lt(compare(Employee{"bob", 30, 100.0}, Employee{"alice", 40, 100.0})));
+    CHECK(std::is_gt(compare(Employee{"bob", 30, 100.0}, Employee{"alice", 30, 100.0})));
+  }
+
+  TEST_CASE("nested_and_less_only_members") {
+    static_assert(std::same_as<ctti::reflected_compare_category<Nested>, std::weak_ordering>);
+
+    constexpr ctti::reflected_compare<Nested> compare;
+    CHECK(std::is_lt(compare(Nested{{1, 0, 0, ""}, {5}}, Nested{{1, 0, 0, ""}, {6}})));
+    CHECK(std::is_gt(compare(Nested{{1, 0, 1, ""}, {5}}, Nested{{1, 0, 0, ""}, {6}})));
+    CHECK(ctti::reflected_equal<Nested>{}(Nested{{1, 0, 0, "x"}, {5}}, Nested{{1, 0, 0, "x"}, {5}}));
+  }
+
+  TEST_CASE("sort_with_reflected_less") {
+    std::vector<Version> versions = {{1, 10, 0, ""}, {1, 2, 0, ""}, {0, 9, 9, ""}, {1, 2, 0, "rc"}};
+    std::sort(versions.begin(), versions.end(), ctti::reflected_less<Version>{});
+
+    CHECK_EQ(versions[0].major, 0);
+    CHECK_EQ(versions[1].minor, 2);
+    CHECK_EQ(versions[1].label, "");
+    CHECK_EQ(versions[2].label, "rc");
+    CHECK_EQ(versions[3].minor, 10);
+  }
+}
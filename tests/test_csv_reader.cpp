@@ -0,0 +1,151 @@
+#include "doctest.h"
+
+#include <ctti/csv_reader.hpp>
+#include <ctti/enum_utils.hpp>
+#include <ctti/reflection.hpp>
+
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+enum class Side : std::uint8_t { kBuy, kSell };
+
+enum class Venue : std::uint8_t { kLit = 1, kDark = 2 };
+
+struct Trade {
+  std::uint32_t id = 0;
+  std::string symbol;
+  double price = 0.0;
+  Side side = Side::kBuy;
+  Venue venue = Venue::kLit;
+  bool settled = false;
+  std::int64_t quantity = -1;
+};
+
+struct Unsupported {
+  std::vector<int> values;
+};
+
+}  // namespace
+
+template <>
+struct ctti::enum_values<Side> {
+  static constexpr auto values = ctti::make_enum_list<Side::kBuy, Side::kSell>();
+};
+
+template <>
+struct ctti::meta<Trade> {
+  using type = Trade;
+  static constexpr auto reflection = ctti::make_reflection(
+      ctti::member<"id", &Trade::id>(), ctti::member<"symbol", &Trade::symbol>(),
+      ctti::member<"price", &Trade::price>(), ctti::member<"side", &Trade::side>(),
+      ctti::member<"venue", &Trade::venue>(),
+      ctti::member<"settled", &Trade::settled>(), ctti::member<"quantity", &Trade::quantity>());
+};
+
+template <>
+struct ctti::meta<Unsupported> {
+  using type = Unsupported;
+  static constexpr auto reflection = ctti::make_reflection(ctti::member<"values", &Unsupported::values>());
+};
+
+namespace {
+
+std::vector<Trade> ReadAll(ctti::csv_reader<Trade>& reader) {
+  std::vector<Trade> trades;
+  Trade trade;
+  while (reader.next(trade)) {
+    trades.push_back(trade);
+    trade = Trade{};
+  }
+  return trades;
+}
+
+}  // namespace
+
+TEST_SUITE("csv_reader") {
+  TEST_CASE("csv_readable") {
+    static_assert(ctti::csv_readable<Trade>);
+    static_assert(!ctti::csv_readable<Unsupported>);
+  }
+
+  TEST_CASE("maps_header_columns") {
+    std::istringstream input(
+        "\xEF\xBB\xBFprice,ignored,symbol,id,side,venue,settled\r\n"
+        "101.25,x,ABC,1,kSell,2,true\r\n"
+        "+99.5,y,XYZ,2,0,1,0\r\n");
+    ctti::csv_reader<Trade> reader(input);
+
+    const auto trades = ReadAll(reader);
+    CHECK_FALSE(reader.failed());
+    CHECK_EQ(reader.matched_columns(), 6);
+    REQUIRE_EQ(trades.size(), 2);
+    CHECK_EQ(trades[0].id, 1);
+    CHECK_EQ(trades[0].symbol, "ABC");
+    CHECK_EQ(trades[0].price, 101.25);
+    CHECK_EQ(trades[0].side, Side::kSell);
+    CHECK_EQ(trades[0].venue, Venue::kDark);
+    CHECK(trades[0].settled);
+    CHECK_EQ(trades[0].quantity, -1);
+    CHECK_EQ(trades[1].price, 99.5);
+    CHECK_EQ(trades[1].side, Side::kBuy);
+    CHECK_FALSE(trades[1].settled);
+  }
+
+  TEST_CASE("quoted_cells") {
+    std::istringstream input(
+        "id,symbol,quantity\n"
+        "1,\"A,B\",10\n"
+        "2,\"say \"\"hi\"\"\nthere\",\n"
+        "\n"
+        "3,,30");
+    ctti::csv_reader<Trade> reader(input);
+
+    const auto trades = ReadAll(reader);
+    REQUIRE_EQ(trades.size(), 3);
+    CHECK_EQ(trades[0].symbol, "A,B");
+    CHECK_EQ(trades[1].symbol, "say \"hi\"\nthere");
+    CHECK_EQ(trades[1].quantity, -1);
+    CHECK(trades[2].symbol.empty());
+    CHECK_EQ(trades[2].quantity, 30);
+  }
+
+  TEST_CASE("tsv_and_small_buffer") {
+    std::ostringstream text;
+    text << "symbol\tid\n";
+    for (int i = 0; i < 100; ++i) {
+      text << "a-rather-long-symbol-name-" << i << '\t' << i << '\n';
+    }
+    std::istringstream input(text.str());
+    ctti::csv_reader<Trade> reader(input, '\t', 8);
+
+    const auto trades = ReadAll(reader);
+    REQUIRE_EQ(trades.size(), 100);
+    CHECK_EQ(trades[57].id, 57);
+    CHECK_EQ(trades[57].symbol, "a-rather-long-symbol-name-57");
+    CHECK_EQ(reader.line(), 101);
+  }
+
+  TEST_CASE("parse_error") {
+    std::istringstream input("id,price\n1,2.5\n2,abc\n3,4.5\n");
+    ctti::csv_reader<Trade> reader(input);
+
+    Trade trade;
+    CHECK(reader.next(trade));
+    CHECK_FALSE(reader.next(trade));
+    CHECK(reader.failed());
+    CHECK_EQ(reader.line(), 3);
+    CHECK_FALSE(reader.next(trade));
+  }
+
+  TEST_CASE("empty_input") {
+    std::istringstream input("");
+    ctti::csv_reader<Trade> reader(input);
+    Trade trade;
+    CHECK_FALSE(reader.next(trade));
+    CHECK_FALSE(reader.failed());
+  }
+}
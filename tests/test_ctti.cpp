@@ -0,0 +1,33 @@
+#include "doctest.h"
+
+#include <ctti/ctti.hpp>
+
+#include <string>
+
+namespace {
+
+struct Sample {
+  int id = 0;
+  std::string label;
+};
+
+}  // namespace
+
+template <>
+struct ctti::meta<Sample> {
+  using type = Sample;
+  static constexpr auto reflection =
+      ctti::make_reflection(ctti::member<"id", &Sample::id>(), ctti::member<"label", &Sample::label>());
+};
+
+TEST_SUITE("ctti") {
+  TEST_CASE("umbrella_header") {
+    static_assert(ctti::reflectable<Sample>);
+    static_assert(ctti::serializable<Sample>);
+
+    ctti::soa_vector<Sample> samples;
+    samples.push_back(Sample{1, "one"});
+    CHECK_EQ(samples.column<"label">()[0], "one");
+    CHECK_EQ(ctti::get_symbol_names<Sample>()[1], "label");
+  }
+}
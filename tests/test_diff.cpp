@@ -0,0 +1,177 @@
+#include "doctest.h"
+
+#include <ctti/aggregate.hpp>
+#include <ctti/diff.hpp>
+#include <ctti/reflection.hpp>
+#include <ctti/serialize.hpp>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace {
+
+struct Position {
+  double x = 0.0;
+  double y = 0.0;
+};
+
+struct PlayerState {
+  std::uint32_t id = 0;
+  std::string name;
+  Position position;
+  std::vector<int> inventory;
+  int health = 100;
+
+  void heal() { health = 100; }
+};
+
+struct Many {
+  int f00, f01, f02, f03, f04, f05, f06, f07, f08, f09;
+  int f10, f11, f12, f13, f14, f15, f16, f17, f18, f19;
+  int f20, f21, f22, f23, f24, f25, f26, f27, f28, f29;
+  int f30, f31, f32, f33, f34, f35, f36, f37, f38, f39;
+};
+
+}  // namespace
+
+template <>
+struct ctti::meta<Position> {
+  using type = Position;
+
+  static constexpr auto reflection =
+      ctti::make_reflection(ctti::member<"x", &Position::x>(), ctti::member<"y", &Position::y>());
+};
+
+template <>
+struct ctti::meta<PlayerState> {
+  using type = PlayerState;
+
+  static constexpr auto reflection = ctti::make_reflection(
+      ctti::member<"id", &PlayerState::id>(), ctti::member<"name", &PlayerState::name>(),
+      ctti::member<"position", &PlayerState::position>(), ctti::member<"inventory", &PlayerState::inventory>(),
+      ctti::member<"health", &PlayerState::health>(), ctti::member<"heal", &PlayerState::heal>());
+};
+
+template <>
+struct ctti::meta<Many> : ctti::aggregate_meta<Many> {};
+
+TEST_SUITE("diff") {
+  TEST_CASE("mask_type") {
+    static_assert(ctti::patch<PlayerState>::field_count == 5);
+    static_assert(std::same_as<ctti::patch<PlayerState>::mask_type, std::uint8_t>);
+    static_assert(std::same_as<ctti::patch<Many>::mask_type, std::uint64_t>);
+  }
+
+  TEST_CASE("no_changes") {
+    const PlayerState state{7, "alice", {1.0, 2.0}, {1, 2}, 80};
+    const auto changes = ctti::diff(state, state);
+
+    CHECK(changes.empty());
+    CHECK_EQ(changes.mask(), 0);
+  }
+
+  TEST_CASE("changed_fields") {
+    const PlayerState before{7, "alice", {1.0, 2.0}, {1, 2}, 80};
+    PlayerState after = before;
+    after.position.y = 3.0;
+    after.health = 75;
+
+    const auto changes = ctti::diff(before, after);
+    CHECK_EQ(changes.changed_count(), 2);
+    CHECK_EQ(changes.mask(), 0b10100);
+    CHECK(changes.changed<"position">());
+    CHECK(changes.changed<"health">());
+    CHECK_FALSE(changes.changed<"name">());
+
+    REQUIRE(changes.value<"health">() != nullptr);
+    CHECK_EQ(*changes.value<"health">(), 75);
+    CHECK_EQ(changes.value<"inventory">(), nullptr);
+  }
+
+  TEST_CASE("apply_patch") {
+    const PlayerState before{7, "alice", {1.0, 2.0}, {1, 2}, 80};
+    PlayerState after = before;
+    after.name = "bob";
+    after.inventory.push_back(3);
+
+    PlayerState replica = before;
+    ctti::apply_patch(replica, ctti::diff(before, after));
+
+    CHECK_EQ(replica.name, "bob");
+    CHECK_EQ(replica.inventory, std::vector<int>{1, 2, 3});
+    CHECK_EQ(replica.health, 80);
+  }
+
+  TEST_CASE("move_aware") {
+    const PlayerState before{7, "alice", {}, {}, 80};
+    PlayerState after = before;
+    after.name = std::string(64, 'z');
+
+    auto changes = ctti::diff(before, std::move(after));
+    REQUIRE(changes.changed<"name">());
+    CHECK_EQ(changes.value<"name">()->size(), 64);
+
+    PlayerState replica = before;
+    ctti::apply_patch(replica, std::move(changes));
+    CHECK_EQ(replica.name.size(), 64);
+  }
+
+  TEST_CASE("manual_patch") {
+    ctti::patch<PlayerState> changes;
+    changes.set<"health">(1);
+    CHECK_EQ(changes.changed_count(), 1);
+
+    PlayerState state;
+    ctti::apply_patch(state, changes);
+    CHECK_EQ(state.health, 1);
+
+    changes.clear();
+    CHECK(changes.empty());
+  }
+
+  TEST_CASE("aggregate") {
+    Many before{};
+    Many after{};
+    after.f33 = 1;
+
+    const auto changes = ctti::diff(before, after);
+    CHECK_EQ(changes.mask(), std::uint64_t{1} << 33);
+
+    ctti::apply_patch(before, changes);
+    CHECK_EQ(before.f33, 1);
+  }
+
+  TEST_CASE("serialize_patch") {
+    const PlayerState before{7, "alice", {1.0, 2.0}, {1, 2, 3, 4}, 80};
+    PlayerState after = before;
+    after.health = 75;
+
+    ctti::byte_writer full;
+    ctti::serialize(after, full);
+    ctti::byte_writer writer;
+    ctti::serialize_patch(ctti::diff(before, after), writer);
+    CHECK_EQ(writer.size(), sizeof(ctti::patch<PlayerState>::mask_type) + sizeof(int));
+    CHECK_LT(writer.size(), full.size());
+
+    ctti::byte_reader reader(writer.bytes());
+    ctti::patch<PlayerState> changes;
+    REQUIRE(ctti::deserialize_patch(reader, changes));
+    CHECK_EQ(changes.mask(), 0b10000);
+
+    PlayerState replica = before;
+    ctti::apply_patch(replica, changes);
+    CHECK_EQ(replica.health, 75);
+    CHECK_EQ(replica.inventory, before.inventory);
+  }
+
+  TEST_CASE("deserialize_patch_rejects_unknown_fields") {
+    const std::uint8_t mask = 0b100000;
+    ctti::byte_writer writer;
+    writer.write_bytes(&mask, sizeof(mask));
+
+    ctti::byte_reader reader(writer.bytes());
+    ctti::patch<PlayerState> changes;
+    CHECK_FALSE(ctti::deserialize_patch(reader, changes));
+  }
+}
@@ -0,0 +1,158 @@
+#include "doctest.h"
+
+#include <ctti/flatten.hpp>
+#include <ctti/reflection.hpp>
+
+#include <cstddef>
+#include <string>
+#include <type_traits>
+
+namespace {
+
+struct Vec3 {
+  double x = 0.0;
+  double y = 0.0;
+  double z = 0.0;
+};
+
+struct Pose {
+  Vec3 position;
+  Vec3 orientation;
+};
+
+struct Robot {
+  int id = 0;
+  Pose pose;
+  float battery = 0.0F;
+};
+
+struct Named {
+  std::string name;
+  Vec3 origin;
+};
+
+}  // namespace
+
+template <>
+struct ctti::meta<Vec3> {
+  using type = Vec3;
+
+  static constexpr auto reflection = ctti::make_reflection(ctti::member<"x", &Vec3::x>(), ctti::member<"y", &Vec3::y>(),
+                                                           ctti::member<"z", &Vec3::z>());
+};
+
+template <>
+struct ctti::meta<Pose> {
+  using type = Pose;
+
+  static constexpr auto reflection = ctti::make_reflection(ctti::member<"position", &Pose::position>(),
+                                                           ctti::member<"orientation", &Pose::orientation>());
+};
+
+template <>
+struct ctti::meta<Robot> {
+  using type = Robot;
+
+  static constexpr auto reflection =
+      ctti::make_reflection(ctti::member<"id", &Robot::id>(), ctti::member<"pose", &Robot::pose>(),
+                            ctti::member<"battery", &Robot::battery>());
+};
+
+template <>
+struct ctti::meta<Named> {
+  using type = Named;
+
+  static constexpr auto reflection =
+      ctti::make_reflection(ctti::member<"name", &Named::name>(), ctti::member<"origin", &Named::origin>());
+};
+
+TEST_SUITE("flatten") {
+  TEST_CASE("leaf_paths") {
+    using flat = ctti::flattened<Robot>;
+
+    static_assert(flat::leaf_count == 8);
+    static_assert(flat::paths[0] == "id");
+    static_assert(flat::paths[1] == "pose.position.x");
+    static_assert(flat::paths[6] == "pose.orientation.z");
+    static_assert(flat::paths[7] == "battery");
+
+    static_assert(flat::has_path<"pose.orientation.y">());
+    static_assert(!flat::has_path<"pose.position">());
+    static_assert(std::same_as<flat::leaf_type<"battery">, float>);
+  }
+
+  TEST_CASE("compile_time_get") {
+    Robot robot;
+    ctti::flattened<Robot>::get<"pose.position.y">(robot) = 2.5;
+    CHECK_EQ(robot.pose.position.y, 2.5);
+
+    const Robot& view = robot;
+    CHECK(std::same_as<decltype(ctti::flattened<Robot>::get<"pose.position.y">(view)), const double&>);
+  }
+
+  TEST_CASE("find") {
+    using flat = ctti::flattened<Robot>;
+
+    for (std::size_t i = 0; i < flat::leaf_count; ++i) {
+      CHECK_EQ(flat::find(flat::paths[i]), i);
+    }
+    CHECK_EQ(flat::find("pose.position"), flat::leaf_count);
+    CHECK_EQ(flat::find("unknown"), flat::leaf_count);
+    CHECK_EQ(flat::find(""), flat::leaf_count);
+
+    static_assert(flat::find("battery") == 7);
+  }
+
+  TEST_CASE("offsets") {
+    using flat = ctti::flattened<Robot>;
+    const auto& offsets = flat::offsets();
+
+    CHECK_EQ(offsets[0], offsetof(Robot, id));
+    CHECK_EQ(offsets[flat::find("pose.orientation.z")], offsetof(Robot, pose) + offsetof(Pose, orientation) +
+                                                            offsetof(Vec3, z));
+    CHECK_EQ(offsets[7], offsetof(Robot, battery));
+  }
+
+  TEST_CASE("get_by_path") {
+    Robot robot;
+    robot.pose.orientation.x = 1.5;
+
+    double* x = ctti::get_by_path<double>(robot, "pose.orientation.x");
+    REQUIRE(x != nullptr);
+    CHECK_EQ(*x, 1.5);
+    *x = 3.0;
+    CHECK_EQ(robot.pose.orientation.x, 3.0);
+
+    CHECK(ctti::get_by_path<int>(robot, "pose.orientation.x") == nullptr);
+    CHECK(ctti::get_by_path<double>(robot, "pose.orientation") == nullptr);
+
+    const Robot& view = robot;
+    const float* battery = ctti::get_by_path<float>(view, "battery");
+    REQUIRE(battery != nullptr);
+    CHECK_EQ(battery, &robot.battery);
+  }
+
+  TEST_CASE("visit_path") {
+    Named named{"origin", {1.0, 2.0, 3.0}};
+
+    std::string seen;
+    CHECK(ctti::visit_path(named, "origin.z", [&](const auto& value) {
+      if constexpr (std::same_as<std::remove_cvref_t<decltype(value)>, double>) {
+        seen = std::to_string(static_cast<int>(value));
+      } else {
+        seen = value;
+      }
+    }));
+    CHECK_EQ(seen, "3");
+
+    const Named& view = named;
+    CHECK(ctti::visit_path(view, "name", [&](const auto& value) {
+      if constexpr (std::same_as<std::remove_cvref_t<decltype(value)>, std::string>) {
+        seen = value;
+      }
+    }));
+    CHECK_EQ(seen, "origin");
+
+    CHECK_FALSE(ctti::visit_path(named, "origin.w", [](const auto&) {}));
+  }
+}
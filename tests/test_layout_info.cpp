@@ -0,0 +1,97 @@
+#include "doctest.h"
+
+#include <ctti/layout_info.hpp>
+#include <ctti/reflection.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace {
+
+struct Wasteful {
+  std::uint8_t flag = 0;
+  std::uint64_t id = 0;
+  std::uint8_t kind = 0;
+  std::uint32_t count = 0;
+  std::uint16_t port = 0;
+};
+
+struct Packed {
+  std::uint64_t id = 0;
+  std::uint32_t count = 0;
+  std::uint16_t port = 0;
+  std::uint8_t flag = 0;
+  std::uint8_t kind = 0;
+};
+
+}  // namespace
+
+template <>
+struct ctti::meta<Wasteful> {
+  using type = Wasteful;
+
+  static constexpr auto reflection = ctti::make_reflection(
+      ctti::member<"flag", &Wasteful::flag>(), ctti::member<"id", &Wasteful::id>(),
+      ctti::member<"kind", &Wasteful::kind>(), ctti::member<"count", &Wasteful::count>(),
+      ctti::member<"port", &Wasteful::port>());
+};
+
+template <>
+struct ctti::meta<Packed> {
+  using type = Packed;
+
+  static constexpr auto reflection =
+      ctti::make_reflection(ctti::member<"id", &Packed::id>(), ctti::member<"count", &Packed::count>(),
+                            ctti::member<"port", &Packed::port>(), ctti::member<"flag", &Packed::flag>(),
+                            ctti::member<"kind", &Packed::kind>());
+};
+
+TEST_SUITE("layout_info") {
+  TEST_CASE("sizes_and_padding") {
+    using layout = ctti::layout_info<Wasteful>;
+
+    static_assert(layout::field_count == 5);
+    static_assert(layout::size == sizeof(Wasteful));
+    static_assert(layout::alignment == alignof(Wasteful));
+    static_assert(layout::data_size == 16);
+    static_assert(layout::padding_bytes == sizeof(Wasteful) - 16);
+
+    static_assert(ctti::layout_info<Packed>::padding_bytes == 0);
+  }
+
+  TEST_CASE("suggested_order") {
+    using layout = ctti::layout_info<Wasteful>;
+
+    static_assert(layout::suggested_order[0] == "id");
+    static_assert(layout::suggested_order[1] == "count");
+    static_assert(layout::suggested_order[2] == "port");
+    static_assert(layout::suggested_order[3] == "flag");
+    static_assert(layout::suggested_order[4] == "kind");
+
+    static_assert(layout::optimal_size == sizeof(Packed));
+    static_assert(layout::reorder_savings == sizeof(Wasteful) - sizeof(Packed));
+    static_assert(ctti::layout_info<Packed>::reorder_savings == 0);
+  }
+
+  TEST_CASE("padding_budget") {
+    static_assert(ctti::padding_within_budget<Packed, 0>);
+    static_assert(!ctti::padding_within_budget<Wasteful, 0>);
+    static_assert(ctti::padding_within_budget<Wasteful, ctti::layout_info<Wasteful>::padding_bytes>);
+  }
+
+  TEST_CASE("offsets") {
+    using layout = ctti::layout_info<Wasteful>;
+
+    CHECK_EQ(layout::offset_of<"flag">(), offsetof(Wasteful, flag));
+    CHECK_EQ(layout::offset_of<"id">(), offsetof(Wasteful, id));
+    CHECK_EQ(layout::offset_of<"port">(), offsetof(Wasteful, port));
+
+    const auto fields = layout::fields();
+    REQUIRE_EQ(fields.size(), 5);
+    CHECK_EQ(fields[1].name, "id");
+    CHECK_EQ(fields[1].offset, offsetof(Wasteful, id));
+    CHECK_EQ(fields[1].size, sizeof(std::uint64_t));
+    CHECK_EQ(fields[1].alignment, alignof(std::uint64_t));
+    CHECK_EQ(fields[3].offset, offsetof(Wasteful, count));
+  }
+}
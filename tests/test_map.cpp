@@ -1,9 +1,14 @@
 #include "doctest.h"
 
 #include <ctti/map.hpp>
+#include <ctti/reflection.hpp>
 #include <ctti/symbol.hpp>
 
+#include <cstdint>
+#include <span>
 #include <string>
+#include <utility>
+#include <vector>
 
 namespace {
 
@@ -19,8 +24,79 @@ struct Sink {
   bool active = false;
 };
 
+struct Frame {
+  std::vector<int> payload;
+  std::string header;
+  int sequence = 0;
+};
+
+struct Packet {
+  std::vector<int> payload;
+  std::string header;
+  int sequence = 0;
+};
+
+struct Tick {
+  std::int64_t time = 0;
+  double price = 0.0;
+  std::int32_t size = 0;
+  std::int32_t venue = 0;
+  std::string symbol;
+};
+
+struct Row {
+  std::string symbol;
+  std::int64_t time = 0;
+  double price = 0.0;
+  std::int32_t size = 0;
+  bool large = false;
+};
+
+struct Point {
+  double x = 0.0;
+  double y = 0.0;
+};
+
+struct Vec {
+  double x = 0.0;
+  double y = 0.0;
+};
+
+struct OrderDto {
+  std::string id;
+  double price = 0.0;
+  int quantity = 0;
+  std::string trace_id;
+};
+
+struct Order {
+  std::string id;
+  double price = 0.0;
+  long quantity = 0;
+  bool filled = false;
+
+  std::string describe() const { return id; }
+};
+
 }  // namespace
 
+template <>
+struct ctti::meta<OrderDto> {
+  using type = OrderDto;
+  static constexpr auto reflection = ctti::make_reflection(
+      ctti::member<"id", &OrderDto::id>(), ctti::member<"price", &OrderDto::price>(),
+      ctti::member<"quantity", &OrderDto::quantity>(), ctti::member<"trace_id", &OrderDto::trace_id>());
+};
+
+template <>
+struct ctti::meta<Order> {
+  using type = Order;
+  static constexpr auto reflection = ctti::make_reflection(
+      ctti::member<"filled", &Order::filled>(), ctti::member<"price", &Order::price>(),
+      ctti::member<"id", &Order::id>(), ctti::member<"quantity", &Order::quantity>(),
+      ctti::member<"describe", &Order::describe>());
+};
+
 TEST_SUITE("map") {
   TEST_CASE("basic_mapping") {
     Source src;
@@ -97,4 +173,192 @@ TEST_SUITE("map") {
     CHECK_EQ(dst.name, "source");
     CHECK(dst.active);  // price > 50.0
   }
+
+  TEST_CASE("auto_mapping_join") {
+    using mapping = ctti::auto_mapping<OrderDto, Order>;
+    static_assert(mapping::matched.size() == 2);
+    static_assert(mapping::matched[0] == "id");
+    static_assert(mapping::matched[1] == "price");
+    static_assert(mapping::unmatched_source.size() == 2);
+    static_assert(mapping::unmatched_source[0] == "quantity");  // int in the DTO, long in the domain type
+    static_assert(mapping::unmatched_source[1] == "trace_id");
+    static_assert(mapping::unmatched_sink.size() == 2);
+    static_assert(mapping::unmatched_sink[0] == "filled");
+    static_assert(mapping::unmatched_sink[1] == "quantity");
+
+    static_assert(ctti::auto_mapping<Order, Order>::unmatched_sink.empty());
+  }
+
+  TEST_CASE("auto_map") {
+    const OrderDto dto{.id = "A-1", .price = 12.5, .quantity = 3, .trace_id = "t"};
+    Order order{.id = "", .price = 0.0, .quantity = 9, .filled = true};
+    ctti::auto_map(dto, order);
+    CHECK_EQ(order.id, "A-1");
+    CHECK_EQ(order.price, 12.5);
+    CHECK_EQ(order.quantity, 9);
+    CHECK(order.filled);
+
+    Order copy;
+    ctti::auto_map(order, copy);
+    CHECK_EQ(copy.id, "A-1");
+    CHECK_EQ(copy.quantity, 9);
+    CHECK(copy.filled);
+  }
+
+  TEST_CASE("move_mapping") {
+    constexpr auto payload_src = ctti::make_simple_symbol<"payload", &Frame::payload>();
+    constexpr auto payload_dst = ctti::make_simple_symbol<"payload", &Packet::payload>();
+    constexpr auto header_src = ctti::make_simple_symbol<"header", &Frame::header>();
+    constexpr auto header_dst = ctti::make_simple_symbol<"header", &Packet::header>();
+    constexpr auto sequence_src = ctti::make_simple_symbol<"sequence", &Frame::sequence>();
+    constexpr auto sequence_dst = ctti::make_simple_symbol<"sequence", &Packet::sequence>();
+
+    Frame frame{.payload = std::vector<int>(1024, 7), .header = std::string(256, 'h'), .sequence = 4};
+    const int* buffer = frame.payload.data();
+    Packet packet;
+
+    ctti::map<payload_src, payload_dst>(std::move(frame), packet);
+    CHECK_EQ(packet.payload.data(), buffer);
+    CHECK(frame.payload.empty());  // Moved from
+
+    Frame next{.payload = std::vector<int>(16, 1), .header = std::string(256, 'x'), .sequence = 9};
+    const char* header = next.header.data();
+    const int* payload = next.payload.data();
+    ctti::map(std::move(next), packet, ctti::make_mapping<payload_src, payload_dst>(),
+              ctti::make_mapping<header_src, header_dst>(), ctti::make_mapping<sequence_src, sequence_dst>());
+    CHECK_EQ(packet.payload.data(), payload);
+    CHECK_EQ(packet.header.data(), header);
+    CHECK_EQ(packet.sequence, 9);
+  }
+
+  TEST_CASE("move_mapping_custom_function") {
+    constexpr auto header_src = ctti::make_simple_symbol<"header", &Frame::header>();
+    constexpr auto header_dst = ctti::make_simple_symbol<"header", &Packet::header>();
+
+    Frame frame{.payload = {}, .header = std::string(100, 'a'), .sequence = 0};
+    Packet packet;
+    bool moved = false;
+    ctti::map<header_src, header_dst>(std::move(frame), packet, [&](auto&& source, auto, Packet& sink, auto) {
+      moved = !std::is_lvalue_reference_v<decltype(source)>;
+      sink.header = std::move(source.header);
+    });
+    CHECK(moved);
+    CHECK_EQ(packet.header.size(), 100);
+  }
+
+  TEST_CASE("lvalue_mapping_still_copies") {
+    constexpr auto header_src = ctti::make_simple_symbol<"header", &Frame::header>();
+    constexpr auto header_dst = ctti::make_simple_symbol<"header", &Packet::header>();
+
+    Frame frame{.payload = {}, .header = std::string(100, 'a'), .sequence = 0};
+    Packet packet;
+    ctti::map<header_src, header_dst>(frame, packet);
+    ctti::map(frame, packet, ctti::make_mapping<header_src, header_dst>());
+    CHECK_EQ(frame.header.size(), 100);
+    CHECK_EQ(packet.header.size(), 100);
+  }
+
+  TEST_CASE("map_range") {
+    constexpr auto tick_time = ctti::make_simple_symbol<"time", &Tick::time>();
+    constexpr auto tick_price = ctti::make_simple_symbol<"price", &Tick::price>();
+    constexpr auto tick_size = ctti::make_simple_symbol<"size", &Tick::size>();
+    constexpr auto tick_symbol = ctti::make_simple_symbol<"symbol", &Tick::symbol>();
+    constexpr auto row_time = ctti::make_simple_symbol<"time", &Row::time>();
+    constexpr auto row_price = ctti::make_simple_symbol<"price", &Row::price>();
+    constexpr auto row_size = ctti::make_simple_symbol<"size", &Row::size>();
+    constexpr auto row_symbol = ctti::make_simple_symbol<"symbol", &Row::symbol>();
+    constexpr auto row_large = ctti::make_simple_symbol<"large", &Row::large>();
+
+    using time_mapping = ctti::symbol_mapping<tick_time, row_time>;
+    static_assert(ctti::detail::IsBytewiseMapping<time_mapping, Tick, Row>());
+    static_assert(!ctti::detail::IsBytewiseMapping<ctti::symbol_mapping<tick_symbol, row_symbol>, Tick, Row>());
+
+    std::vector<Tick> ticks(100);
+    for (std::size_t i = 0; i < ticks.size(); ++i) {
+      ticks[i] = Tick{.time = static_cast<std::int64_t>(i) * 10,
+                      .price = 1.5 * static_cast<double>(i),
+                      .size = static_cast<std::int32_t>(i),
+                      .venue = 3,
+                      .symbol = "S" + std::to_string(i)};
+    }
+    std::vector<Row> rows(100);
+
+    ctti::map_range(std::span<const Tick>(ticks), std::span<Row>(rows), ctti::make_mapping<tick_time, row_time>(),
+                    ctti::make_mapping<tick_price, row_price>(), ctti::make_mapping<tick_size, row_size>(),
+                    ctti::make_mapping<tick_symbol, row_symbol>(),
+                    ctti::make_mapping<tick_size, row_large>([](const Tick& tick, auto, Row& row, auto) {
+                      row.large = tick.size >= 50;
+                    }));
+
+    for (std::size_t i = 0; i < rows.size(); ++i) {
+      CHECK_EQ(rows[i].time, ticks[i].time);
+      CHECK_EQ(rows[i].price, ticks[i].price);
+      CHECK_EQ(rows[i].size, ticks[i].size);
+      CHECK_EQ(rows[i].symbol, ticks[i].symbol);
+      CHECK_EQ(rows[i].large, i >= 50);
+    }
+  }
+
+  TEST_CASE("map_range_whole_object") {
+    constexpr auto point_x = ctti::make_simple_symbol<"x", &Point::x>();
+    constexpr auto point_y = ctti::make_simple_symbol<"y", &Point::y>();
+    constexpr auto vec_x = ctti::make_simple_symbol<"x", &Vec::x>();
+    constexpr auto vec_y = ctti::make_simple_symbol<"y", &Vec::y>();
+
+    const std::vector<Point> points = {{1.0, 2.0}, {3.0, 4.0}, {5.0, 6.0}};
+    std::vector<Vec> vecs(2);
+    ctti::map_range(std::span<const Point>(points), std::span<Vec>(vecs), ctti::make_mapping<point_y, vec_y>(),
+                    ctti::make_mapping<point_x, vec_x>());
+    CHECK_EQ(vecs[0].x, 1.0);
+    CHECK_EQ(vecs[1].x, 3.0);
+    CHECK_EQ(vecs[1].y, 4.0);
+
+    std::vector<Vec> empty;
+    ctti::map_range(std::span<const Point>(points), std::span<Vec>(empty), ctti::make_mapping<point_x, vec_x>());
+    CHECK(empty.empty());
+  }
+
+  TEST_CASE("map_range_parallel") {
+    constexpr auto tick_time = ctti::make_simple_symbol<"time", &Tick::time>();
+    constexpr auto tick_price = ctti::make_simple_symbol<"price", &Tick::price>();
+    constexpr auto tick_size = ctti::make_simple_symbol<"size", &Tick::size>();
+    constexpr auto tick_symbol = ctti::make_simple_symbol<"symbol", &Tick::symbol>();
+    constexpr auto row_time = ctti::make_simple_symbol<"time", &Row::time>();
+    constexpr auto row_price = ctti::make_simple_symbol<"price", &Row::price>();
+    constexpr auto row_size = ctti::make_simple_symbol<"size", &Row::size>();
+    constexpr auto row_symbol = ctti::make_simple_symbol<"symbol", &Row::symbol>();
+    constexpr auto row_large = ctti::make_simple_symbol<"large", &Row::large>();
+
+    std::vector<Tick> ticks(10'000);
+    for (std::size_t i = 0; i < ticks.size(); ++i) {
+      ticks[i] = Tick{.time = static_cast<std::int64_t>(i),
+                      .price = 0.25 * static_cast<double>(i),
+                      .size = static_cast<std::int32_t>(i % 100),
+                      .venue = 1,
+                      .symbol = "S" + std::to_string(i % 7)};
+    }
+
+    const auto map_all = [&](const ctti::exec_policy& policy, std::vector<Row>& rows) {
+      ctti::map_range(policy, std::span<const Tick>(ticks), std::span<Row>(rows),
+                      ctti::make_mapping<tick_time, row_time>(), ctti::make_mapping<tick_price, row_price>(),
+                      ctti::make_mapping<tick_size, row_size>(), ctti::make_mapping<tick_symbol, row_symbol>(),
+                      ctti::make_mapping<tick_size, row_large>([](const Tick& tick, auto, Row& row, auto) {
+                        row.large = tick.size >= 50;
+                      }));
+    };
+
+    std::vector<Row> expected(ticks.size());
+    map_all(ctti::seq, expected);
+    std::vector<Row> rows(ticks.size() - 3);
+    map_all(ctti::exec_policy{.thread_count = 4, .chunk_bytes = 4096}, rows);
+
+    for (std::size_t i = 0; i < rows.size(); ++i) {
+      CHECK_EQ(rows[i].time, expected[i].time);
+      CHECK_EQ(rows[i].price, expected[i].price);
+      CHECK_EQ(rows[i].size, expected[i].size);
+      CHECK_EQ(rows[i].symbol, expected[i].symbol);
+      CHECK_EQ(rows[i].large, expected[i].large);
+    }
+    CHECK_EQ(rows.back().time, static_cast<std::int64_t>(rows.size() - 1));
+  }
 }
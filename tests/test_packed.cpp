@@ -0,0 +1,126 @@
+#include "doctest.h"
+
+#include <ctti/attributes.hpp>
+#include <ctti/packed.hpp>
+#include <ctti/reflection.hpp>
+
+#include <cstdint>
+#include <string>
+
+namespace {
+
+enum class Mode : std::uint8_t { kIdle, kActive, kFault };
+
+enum class Offset : std::int8_t { kBack = -3, kNone = 0, kAhead = 3 };
+
+struct Telemetry {
+  std::uint32_t sensor = 0;
+  std::int32_t temperature = 0;
+  Mode mode = Mode::kIdle;
+  Offset offset = Offset::kNone;
+  bool armed = false;
+  std::uint64_t sequence = 0;
+  std::uint16_t voltage = 0;
+  float load = 0.0F;
+};
+
+struct Wide {
+  std::uint64_t a = 0;
+  bool b = false;
+};
+
+struct Named {
+  std::string name;
+};
+
+}  // namespace
+
+template <>
+struct ctti::meta<Telemetry> {
+  using type = Telemetry;
+  static constexpr auto reflection = ctti::make_reflection(
+      ctti::member<"sensor", &Telemetry::sensor>(ctti::bits<12>{}),
+      ctti::member<"temperature", &Telemetry::temperature>(ctti::bits<10>{}),
+      ctti::member<"mode", &Telemetry::mode>(ctti::bits<2>{}),
+      ctti::member<"offset", &Telemetry::offset>(ctti::bits<3>{}),
+      ctti::member<"armed", &Telemetry::armed>(), ctti::member<"sequence", &Telemetry::sequence>(ctti::bits<40>{}),
+      ctti::member<"voltage", &Telemetry::voltage>(ctti::bits<14>{}), ctti::member<"load", &Telemetry::load>());
+};
+
+template <>
+struct ctti::meta<Wide> {
+  using type = Wide;
+  static constexpr auto reflection =
+      ctti::make_reflection(ctti::member<"a", &Wide::a>(), ctti::member<"b", &Wide::b>());
+};
+
+template <>
+struct ctti::meta<Named> {
+  using type = Named;
+  static constexpr auto reflection = ctti::make_reflection(ctti::member<"name", &Named::name>());
+};
+
+TEST_SUITE("packed") {
+  TEST_CASE("layout") {
+    static_assert(ctti::packable<Telemetry>);
+    static_assert(!ctti::packable<Named>);
+    static_assert(ctti::packed<Telemetry>::bit_count == 12 + 10 + 2 + 3 + 1 + 40 + 14 + 32);
+    static_assert(ctti::packed<Telemetry>::word_count == 2);
+    static_assert(ctti::packed<Wide>::bit_count == 65);
+    static_assert(ctti::packed<Wide>::word_count == 2);
+  }
+
+  TEST_CASE("round_trip") {
+    const Telemetry sample{.sensor = 4095,
+                           .temperature = -512,
+                           .mode = Mode::kFault,
+                           .offset = Offset::kBack,
+                           .armed = true,
+                           .sequence = (std::uint64_t{1} << 40) - 2,
+                           .voltage = 12000,
+                           .load = 0.75F};
+    const auto words = ctti::packed<Telemetry>::pack(sample);
+    CHECK(ctti::packed<Telemetry>::fits(sample));
+
+    const Telemetry restored = ctti::packed<Telemetry>::unpack(words);
+    CHECK_EQ(restored.sensor, sample.sensor);
+    CHECK_EQ(restored.temperature, sample.temperature);
+    CHECK_EQ(restored.mode, sample.mode);
+    CHECK_EQ(restored.offset, sample.offset);
+    CHECK_EQ(restored.armed, sample.armed);
+    CHECK_EQ(restored.sequence, sample.sequence);
+    CHECK_EQ(restored.voltage, sample.voltage);
+    CHECK_EQ(restored.load, sample.load);
+  }
+
+  TEST_CASE("constexpr_and_straddling") {
+    constexpr Wide kWide{.a = ~std::uint64_t{0}, .b = true};
+    constexpr auto kWords = ctti::packed<Wide>::pack(kWide);
+    static_assert(kWords[0] == ~std::uint64_t{0});
+    static_assert(kWords[1] == 1);
+    static_assert(ctti::packed<Wide>::unpack(kWords).b);
+
+    constexpr Telemetry kSample{.sensor = 1, .sequence = 0xABCDEF1234};
+    constexpr auto kPacked = ctti::packed<Telemetry>::pack(kSample);
+    static_assert(kPacked[0] == (1 | (std::uint64_t{0xABCDEF1234} << 28)));
+    static_assert(kPacked[1] == (std::uint64_t{0xABCDEF1234} >> 36));
+    static_assert(ctti::packed<Telemetry>::unpack(kPacked).sequence == 0xABCDEF1234);
+  }
+
+  TEST_CASE("fits_detects_truncation") {
+    Telemetry sample;
+    sample.temperature = 511;
+    CHECK(ctti::packed<Telemetry>::fits(sample));
+    sample.temperature = 512;
+    CHECK_FALSE(ctti::packed<Telemetry>::fits(sample));
+    sample.temperature = 0;
+    sample.sensor = 4096;
+    CHECK_FALSE(ctti::packed<Telemetry>::fits(sample));
+
+    Telemetry into;
+    into.voltage = 7;
+    ctti::packed<Telemetry>::unpack(ctti::packed<Telemetry>::pack(sample), into);
+    CHECK_EQ(into.sensor, 0);
+    CHECK_EQ(into.voltage, 0);
+  }
+}
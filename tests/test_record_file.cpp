@@ -0,0 +1,216 @@
+#include "doctest.h"
+
+#include <ctti/record_file.hpp>
+#include <ctti/reflection.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <ios>
+#include <numeric>
+#include <span>
+#include <sstream>
+#include <streambuf>
+#include <string>
+#include <vector>
+
+namespace {
+
+struct Position {
+  float x;
+  float y;
+};
+
+struct Sample {
+  std::uint32_t id;
+  Position position;
+  double value;
+};
+
+struct OtherSample {
+  std::uint32_t id;
+  double value;
+};
+
+struct Named {
+  std::string name;
+};
+
+}  // namespace
+
+template <>
+struct ctti::meta<Position> {
+  using type = Position;
+  static constexpr auto reflection =
+      ctti::make_reflection(ctti::member<"x", &Position::x>(), ctti::member<"y", &Position::y>());
+};
+
+template <>
+struct ctti::meta<Sample> {
+  using type = Sample;
+  static constexpr auto reflection =
+      ctti::make_reflection(ctti::member<"id", &Sample::id>(), ctti::member<"position", &Sample::position>(),
+                            ctti::member<"value", &Sample::value>());
+};
+
+template <>
+struct ctti::meta<OtherSample> {
+  using type = OtherSample;
+  static constexpr auto reflection =
+      ctti::make_reflection(ctti::member<"id", &OtherSample::id>(), ctti::member<"value", &OtherSample::value>());
+};
+
+template <>
+struct ctti::meta<Named> {
+  using type = Named;
+  static constexpr auto reflection = ctti::make_reflection(ctti::member<"name", &Named::name>());
+};
+
+namespace {
+
+std::vector<Sample> MakeSamples(std::size_t count) {
+  std::vector<Sample> samples(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    samples[i] = {static_cast<std::uint32_t>(i), {static_cast<float>(i), -static_cast<float>(i)}, i * 0.5};
+  }
+  return samples;
+}
+
+std::vector<std::byte> ToBytes(const std::string& contents) {
+  std::vector<std::byte> bytes(contents.size());
+  std::memcpy(bytes.data(), contents.data(), contents.size());
+  return bytes;
+}
+
+// Accepts the first limit bytes and fails every write after them, like a full disk
+class LimitedBuffer : public std::streambuf {
+public:
+  explicit LimitedBuffer(std::size_t limit) : remaining_(limit) {}
+
+protected:
+  std::streamsize xsputn(const char*, std::streamsize count) override {
+    const auto written = std::min(count, static_cast<std::streamsize>(remaining_));
+    remaining_ -= static_cast<std::size_t>(written);
+    return written;
+  }
+
+  int_type overflow(int_type ch) override {
+    if (remaining_ == 0) {
+      return traits_type::eof();
+    }
+    --remaining_;
+    return traits_type::not_eof(ch);
+  }
+
+private:
+  std::size_t remaining_;
+};
+
+std::vector<std::byte> WriteSamples(const std::vector<Sample>& samples, std::size_t chunk_size) {
+  std::ostringstream stream;
+  {
+    ctti::record_file_writer<Sample> writer(stream, chunk_size);
+    writer.write(samples.front());
+    writer.write(std::span<const Sample>(samples).subspan(1));
+    CHECK_EQ(writer.record_count(), samples.size());
+  }
+  return ToBytes(stream.str());
+}
+
+}  // namespace
+
+TEST_SUITE("record_file") {
+  TEST_CASE("columns") {
+    using file = ctti::record_file<Sample>;
+    static_assert(ctti::record_storable<Sample>);
+    static_assert(!ctti::record_storable<Named>);
+    static_assert(file::column_count == 4);
+    static_assert(file::column_names[1] == "position.x");
+    static_assert(std::is_same_v<file::column_type<"position.y">, float>);
+  }
+
+  TEST_CASE("round_trip") {
+    const auto samples = MakeSamples(10);
+    const auto bytes = WriteSamples(samples, 4);
+
+    const auto file = ctti::record_file<Sample>::open(bytes);
+    REQUIRE(file.has_value());
+    CHECK_EQ(file->record_count(), 10);
+    REQUIRE_EQ(file->chunk_count(), 3);
+    CHECK_EQ(file->chunk_size(2), 2);
+
+    std::size_t index = 0;
+    for (std::size_t chunk = 0; chunk < file->chunk_count(); ++chunk) {
+      const auto ids = file->column<"id">(chunk);
+      const auto ys = file->column<"position.y">(chunk);
+      const auto values = file->column<"value">(chunk);
+      REQUIRE_EQ(ids.size(), file->chunk_size(chunk));
+      CHECK_EQ((reinterpret_cast<const std::byte*>(values.data()) - bytes.data()) % 64, 0);
+      for (std::size_t i = 0; i < ids.size(); ++i, ++index) {
+        CHECK_EQ(ids[i], samples[index].id);
+        CHECK_EQ(ys[i], samples[index].position.y);
+        CHECK_EQ(values[i], samples[index].value);
+      }
+    }
+    CHECK_EQ(index, samples.size());
+  }
+
+  TEST_CASE("empty_file") {
+    std::ostringstream stream;
+    { ctti::record_file_writer<Sample> writer(stream); }
+    const auto bytes = ToBytes(stream.str());
+
+    const auto file = ctti::record_file<Sample>::open(bytes);
+    REQUIRE(file.has_value());
+    CHECK_EQ(file->record_count(), 0);
+    CHECK_EQ(file->chunk_count(), 0);
+  }
+
+  TEST_CASE("destructor_swallows_errors") {
+    LimitedBuffer buffer(sizeof(ctti::detail::RecordFileHeader));
+    std::ostream stream(&buffer);
+    CHECK_NOTHROW([&] {
+      ctti::record_file_writer<Sample> writer(stream);
+      writer.write(std::span<const Sample>(MakeSamples(3)));
+      stream.exceptions(std::ios::badbit);
+    }());
+  }
+
+  TEST_CASE("reports_stream_errors") {
+    LimitedBuffer buffer(sizeof(ctti::detail::RecordFileHeader) + 100);
+    std::ostream stream(&buffer);
+    ctti::record_file_writer<Sample> writer(stream, 4);
+    const auto samples = MakeSamples(4);
+    CHECK_NOTHROW(writer.write(std::span<const Sample>(samples).first(3)));
+    CHECK_THROWS_AS(writer.write(samples.back()), std::ios_base::failure);
+    CHECK_THROWS_AS(writer.close(), std::ios_base::failure);
+
+    LimitedBuffer full(0);
+    std::ostream full_stream(&full);
+    CHECK_THROWS_AS(ctti::record_file_writer<Sample>{full_stream}, std::ios_base::failure);
+  }
+
+  TEST_CASE("rejects_other_schema_and_corruption") {
+    const auto bytes = WriteSamples(MakeSamples(5), 2);
+
+    CHECK_FALSE(ctti::record_file<OtherSample>::open(bytes).has_value());
+    CHECK_FALSE(ctti::record_file<Sample>::open(std::span(bytes).first(bytes.size() - 1)).has_value());
+    CHECK_FALSE(ctti::record_file<Sample>::open({}).has_value());
+
+    auto swapped = bytes;
+    // Byte order mark as a machine with the other byte order would have written it
+    const auto mark = swapped.begin() + offsetof(ctti::detail::RecordFileHeader, byte_order_mark);
+    std::reverse(mark, mark + sizeof(std::uint32_t));
+    CHECK_FALSE(ctti::record_file<Sample>::open(swapped).has_value());
+
+    auto corrupt = bytes;
+    // Point the first column of the first chunk past the end of the data
+    const std::size_t footer_offset = corrupt.size() - 32;
+    std::uint64_t directory_offset = 0;
+    std::memcpy(&directory_offset, corrupt.data() + footer_offset, sizeof(directory_offset));
+    const std::uint64_t bad_offset = corrupt.size();
+    std::memcpy(corrupt.data() + directory_offset + 4 * 16 + 8, &bad_offset, sizeof(bad_offset));
+    CHECK_FALSE(ctti::record_file<Sample>::open(corrupt).has_value());
+  }
+}
@@ -0,0 +1,139 @@
+#include "doctest.h"
+
+#include <ctti/reflected_hash.hpp>
+#include <ctti/reflection.hpp>
+
+#include <cstdint>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+namespace {
+
+struct Key {
+  std::uint32_t id = 0;
+  std::uint32_t shard = 0;
+
+  bool operator==(const Key&) const = default;
+};
+
+struct Padded {
+  std::uint8_t tag = 0;
+  std::uint64_t value = 0;
+
+  bool operator==(const Padded&) const = default;
+};
+
+struct Record {
+  Key key;
+  std::string name;
+  std::vector<int> values;
+
+  void touch() {}
+
+  bool operator==(const Record&) const = default;
+};
+
+struct NotHashable {
+  int value = 0;
+};
+
+struct WithUnhashable {
+  NotHashable member;
+};
+
+}  // namespace
+
+template <>
+struct ctti::meta<Key> {
+  using type = Key;
+
+  static constexpr auto reflection =
+      ctti::make_reflection(ctti::member<"id", &Key::id>(), ctti::member<"shard", &Key::shard>());
+};
+
+template <>
+struct ctti::meta<Padded> {
+  using type = Padded;
+
+  static constexpr auto reflection =
+      ctti::make_reflection(ctti::member<"tag", &Padded::tag>(), ctti::member<"value", &Padded::value>());
+};
+
+template <>
+struct ctti::meta<Record> {
+  using type = Record;
+
+  static constexpr auto reflection =
+      ctti::make_reflection(ctti::member<"key", &Record::key>(), ctti::member<"name", &Record::name>(),
+                            ctti::member<"values", &Record::values>(), ctti::member<"touch", &Record::touch>());
+};
+
+template <>
+struct ctti::meta<WithUnhashable> {
+  using type = WithUnhashable;
+
+  static constexpr auto reflection = ctti::make_reflection(ctti::member<"member", &WithUnhashable::member>());
+};
+
+TEST_SUITE("reflected_hash") {
+  TEST_CASE("reflected_hashable_concept") {
+    CHECK(ctti::reflected_hashable<Key>);
+    CHECK(ctti::reflected_hashable<Record>);
+    CHECK_FALSE(ctti::reflected_hashable<WithUnhashable>);
+    CHECK_FALSE(ctti::reflected_hashable<NotHashable>);
+  }
+
+  TEST_CASE("byte_path_selection") {
+    CHECK(ctti::detail::kReflectsObjectRepresentation<Key>);
+    CHECK_FALSE(ctti::detail::kReflectsObjectRepresentation<Padded>);
+    CHECK_FALSE(ctti::detail::kReflectsObjectRepresentation<Record>);
+  }
+
+  TEST_CASE("equal_objects_hash_equal") {
+    CHECK_EQ(ctti::hash_value(Key{1, 2}), ctti::hash_value(Key{1, 2}));
+    CHECK_EQ(ctti::hash_value(Padded{1, 2}), ctti::hash_value(Padded{1, 2}));
+
+    const Record lhs{{1, 2}, "name", {1, 2, 3}};
+    const Record rhs{{1, 2}, "name", {1, 2, 3}};
+    CHECK_EQ(ctti::hash_value(lhs), ctti::hash_value(rhs));
+  }
+
+  TEST_CASE("different_objects_hash_differently") {
+    CHECK_NE(ctti::hash_value(Key{1, 2}), ctti::hash_value(Key{2, 1}));
+    CHECK_NE(ctti::hash_value(Padded{1, 2}), ctti::hash_value(Padded{2, 1}));
+
+    const Record base{{1, 2}, "name", {1, 2, 3}};
+    CHECK_NE(ctti::hash_value(base), ctti::hash_value(Record{{1, 3}, "name", {1, 2, 3}}));
+    CHECK_NE(ctti::hash_value(base), ctti::hash_value(Record{{1, 2}, "other", {1, 2, 3}}));
+    CHECK_NE(ctti::hash_value(base), ctti::hash_value(Record{{1, 2}, "name", {1, 2}}));
+  }
+
+  TEST_CASE("hash_bytes") {
+    const std::vector<std::uint8_t> bytes(100, 7);
+    const auto* data = reinterpret_cast<const std::byte*>(bytes.data());
+
+    for (std::size_t size = 0; size < bytes.size(); ++size) {
+      CHECK_EQ(ctti::detail::HashBytes(data, size), ctti::detail::HashBytes(data, size));
+      CHECK_NE(ctti::detail::HashBytes(data, size), ctti::detail::HashBytes(data, size + 1));
+    }
+  }
+
+  TEST_CASE("unordered_set") {
+    std::unordered_set<Key, ctti::reflected_hash<Key>> keys;
+    for (std::uint32_t i = 0; i < 1000; ++i) {
+      keys.insert(Key{i, i % 7});
+    }
+    keys.insert(Key{5, 5});
+
+    CHECK_EQ(keys.size(), 1000);
+    CHECK(keys.contains(Key{42, 0}));
+    CHECK_FALSE(keys.contains(Key{42, 1}));
+
+    std::unordered_set<Record, ctti::reflected_hash<Record>> records;
+    records.insert(Record{{1, 2}, "a", {}});
+    records.insert(Record{{1, 2}, "a", {}});
+    records.insert(Record{{1, 2}, "b", {}});
+    CHECK_EQ(records.size(), 2);
+  }
+}
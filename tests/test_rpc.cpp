@@ -0,0 +1,123 @@
+#include "doctest.h"
+
+#include <ctti/reflection.hpp>
+#include <ctti/rpc.hpp>
+
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <variant>
+#include <vector>
+
+namespace {
+
+using Value = std::variant<std::monostate, int, double, std::string>;
+
+struct ArgumentReader {
+  std::vector<Value> values;
+  std::size_t position = 0;
+
+  template <typename T>
+  T read() {
+    return std::get<T>(values.at(position++));
+  }
+};
+
+struct ResultWriter {
+  Value result;
+
+  template <typename T>
+  void write(T&& value) {
+    result = std::forward<T>(value);
+  }
+};
+
+class Account {
+public:
+  void deposit(int amount) { balance_ += amount; }
+  void deposit(double amount) { balance_ += static_cast<int>(amount * 100) / 100; }
+  int balance() const { return balance_; }
+  std::string describe(const std::string& prefix, int width) const {
+    return prefix + ":" + std::to_string(balance_) + "/" + std::to_string(width);
+  }
+  void rename(std::string name) { owner = std::move(name); }
+
+  std::string owner;
+
+private:
+  int balance_ = 0;
+};
+
+}  // namespace
+
+template <>
+struct ctti::meta<Account> {
+  using type = Account;
+
+  static constexpr auto reflection = ctti::make_reflection(
+      ctti::overloaded_member<"deposit", static_cast<void (Account::*)(int)>(&Account::deposit),
+                              static_cast<void (Account::*)(double)>(&Account::deposit)>(),
+      ctti::member<"balance", &Account::balance>(), ctti::member<"describe", &Account::describe>(),
+      ctti::member<"rename", &Account::rename>(), ctti::member<"owner", &Account::owner>());
+};
+
+using dispatcher = ctti::rpc_dispatcher<Account, ArgumentReader, ResultWriter>;
+
+TEST_SUITE("rpc") {
+  TEST_CASE("method_table") {
+    static_assert(dispatcher::method_count == 5);
+    static_assert(dispatcher::has_method(ctti::rpc_method_key<"deposit", int>()));
+    static_assert(dispatcher::has_method(ctti::rpc_method_key<"deposit", double>()));
+    static_assert(dispatcher::has_method(ctti::rpc_method_key<"describe", std::string, int>()));
+    static_assert(!dispatcher::has_method(ctti::rpc_method_key<"deposit", std::string>()));
+    static_assert(!dispatcher::has_method(ctti::rpc_method_key<"owner">()));
+
+    static_assert(ctti::rpc_method_key<"describe", const std::string&, int>() ==
+                  ctti::rpc_method_key<"describe", std::string, int>());
+    static_assert(ctti::rpc_signature_hash<int, double>() != ctti::rpc_signature_hash<double, int>());
+  }
+
+  TEST_CASE("dispatch_overloads") {
+    Account account;
+    ResultWriter writer;
+
+    ArgumentReader ints{{Value{40}}};
+    CHECK(dispatcher::dispatch(account, "deposit", ctti::rpc_signature_hash<int>(), ints, writer));
+
+    ArgumentReader doubles{{Value{2.5}}};
+    CHECK(dispatcher::dispatch(account, "deposit", ctti::rpc_signature_hash<double>(), doubles, writer));
+
+    ArgumentReader none;
+    CHECK(dispatcher::dispatch(account, ctti::rpc_method_key<"balance">(), none, writer));
+    CHECK_EQ(std::get<int>(writer.result), 42);
+  }
+
+  TEST_CASE("arguments_in_order") {
+    Account account;
+    account.deposit(7);
+
+    ArgumentReader reader{{Value{std::string("acct")}, Value{12}}};
+    ResultWriter writer;
+    CHECK(dispatcher::dispatch(account, ctti::rpc_method_key<"describe", std::string, int>(), reader, writer));
+    CHECK_EQ(std::get<std::string>(writer.result), "acct:7/12");
+  }
+
+  TEST_CASE("by_value_arguments_are_moved") {
+    Account account;
+    ArgumentReader reader{{Value{std::string(64, 'o')}}};
+    ResultWriter writer;
+
+    CHECK(dispatcher::dispatch(account, ctti::rpc_method_key<"rename", std::string>(), reader, writer));
+    CHECK_EQ(account.owner.size(), 64);
+    CHECK(std::holds_alternative<std::monostate>(writer.result));
+  }
+
+  TEST_CASE("unknown_method") {
+    Account account;
+    ArgumentReader reader;
+    ResultWriter writer;
+
+    CHECK_FALSE(dispatcher::dispatch(account, "withdraw", ctti::rpc_signature_hash<int>(), reader, writer));
+    CHECK_FALSE(dispatcher::dispatch(account, "deposit", ctti::rpc_signature_hash<long>(), reader, writer));
+  }
+}
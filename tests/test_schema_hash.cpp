@@ -0,0 +1,166 @@
+#include "doctest.h"
+
+#include <ctti/attributes.hpp>
+#include <ctti/reflection.hpp>
+#include <ctti/schema_hash.hpp>
+
+#include <concepts>
+#include <cstdint>
+#include <vector>
+
+namespace {
+
+struct Point {
+  float x;
+  float y;
+};
+
+struct RenamedPoint {
+  float x;
+  float y;
+};
+
+struct SwappedPoint {
+  float y;
+  float x;
+};
+
+struct AlignedPoint {
+  alignas(8) float x;
+  float y;
+};
+
+struct ReorderedPoint {
+  float y;
+  float x;
+};
+
+struct WidePoint {
+  double x;
+  double y;
+};
+
+struct Segment {
+  Point from;
+  Point to;
+};
+
+struct RenamedSegment {
+  RenamedPoint from;
+  RenamedPoint to;
+};
+
+struct Path {
+  std::vector<Point> points;
+};
+
+struct VersionedPath {
+  std::vector<Point> points;
+};
+
+}  // namespace
+
+template <>
+struct ctti::meta<Point> {
+  using type = Point;
+  static constexpr auto reflection =
+      ctti::make_reflection(ctti::member<"x", &Point::x>(), ctti::member<"y", &Point::y>());
+};
+
+template <>
+struct ctti::meta<RenamedPoint> {
+  using type = RenamedPoint;
+  static constexpr auto reflection =
+      ctti::make_reflection(ctti::member<"x", &RenamedPoint::x>(), ctti::member<"y", &RenamedPoint::y>());
+};
+
+template <>
+struct ctti::meta<SwappedPoint> {
+  using type = SwappedPoint;
+  static constexpr auto reflection =
+      ctti::make_reflection(ctti::member<"y", &SwappedPoint::y>(), ctti::member<"x", &SwappedPoint::x>());
+};
+
+template <>
+struct ctti::meta<AlignedPoint> {
+  using type = AlignedPoint;
+  static constexpr auto reflection =
+      ctti::make_reflection(ctti::member<"x", &AlignedPoint::x>(), ctti::member<"y", &AlignedPoint::y>());
+};
+
+template <>
+struct ctti::meta<ReorderedPoint> {
+  using type = ReorderedPoint;
+  static constexpr auto reflection =
+      ctti::make_reflection(ctti::member<"x", &ReorderedPoint::x>(), ctti::member<"y", &ReorderedPoint::y>());
+};
+
+template <>
+struct ctti::meta<WidePoint> {
+  using type = WidePoint;
+  static constexpr auto reflection =
+      ctti::make_reflection(ctti::member<"x", &WidePoint::x>(), ctti::member<"y", &WidePoint::y>());
+};
+
+template <>
+struct ctti::meta<Segment> {
+  using type = Segment;
+  static constexpr auto reflection =
+      ctti::make_reflection(ctti::member<"from", &Segment::from>(), ctti::member<"to", &Segment::to>());
+};
+
+template <>
+struct ctti::meta<RenamedSegment> {
+  using type = RenamedSegment;
+  static constexpr auto reflection =
+      ctti::make_reflection(ctti::member<"from", &RenamedSegment::from>(), ctti::member<"to", &RenamedSegment::to>());
+};
+
+template <>
+struct ctti::meta<Path> {
+  using type = Path;
+  static constexpr auto reflection = ctti::make_reflection(ctti::member<"points", &Path::points>());
+};
+
+template <>
+struct ctti::meta<VersionedPath> {
+  using type = VersionedPath;
+  static constexpr auto reflection =
+      ctti::make_reflection(ctti::member<"points", &VersionedPath::points>(ctti::since<2>{}));
+};
+
+TEST_SUITE("schema_hash") {
+  TEST_CASE("same_schema_same_hash") {
+    static_assert(ctti::schema_hash<Point>() == ctti::schema_hash<RenamedPoint>());
+    static_assert(ctti::schema_hash<Segment>() == ctti::schema_hash<RenamedSegment>());
+  }
+
+  TEST_CASE("member_order_and_types") {
+    static_assert(ctti::schema_hash<Point>() != ctti::schema_hash<SwappedPoint>());
+    static_assert(ctti::schema_hash<Point>() != ctti::schema_hash<WidePoint>());
+    static_assert(ctti::schema_hash<Point>() != ctti::schema_hash<Segment>());
+  }
+
+  TEST_CASE("size_and_alignment") {
+    static_assert(std::same_as<decltype(ctti::schema_hash<Point>()), std::uint64_t>);
+    static_assert(ctti::schema_hash<Point>() != ctti::schema_hash<AlignedPoint>());
+  }
+
+  TEST_CASE("layout_hash") {
+    static_assert(ctti::schema_hash<Point>() == ctti::schema_hash<ReorderedPoint>());
+    CHECK_EQ(ctti::layout_hash<Point>(), ctti::layout_hash<RenamedPoint>());
+    CHECK_EQ(ctti::layout_hash<Segment>(), ctti::layout_hash<RenamedSegment>());
+    CHECK_NE(ctti::layout_hash<Point>(), ctti::layout_hash<ReorderedPoint>());
+    CHECK_NE(ctti::layout_hash<Point>(), ctti::schema_hash<Point>());
+  }
+
+  TEST_CASE("attributes") {
+    static_assert(ctti::schema_hash<Path>() != ctti::schema_hash<VersionedPath>());
+  }
+
+  TEST_CASE("usable_at_runtime") {
+    const std::uint64_t stored = ctti::schema_hash<Segment>();
+    CHECK_EQ(stored, ctti::schema_hash<RenamedSegment>());
+    CHECK_NE(stored, ctti::schema_hash<Path>());
+  }
+}
@@ -0,0 +1,233 @@
+#include "doctest.h"
+
+#include <ctti/attributes.hpp>
+#include <ctti/reflection.hpp>
+#include <ctti/serialize.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace {
+
+enum class Side : std::uint8_t { kBuy, kSell };
+
+struct Price {
+  std::int64_t units = 0;
+  std::int32_t nanos = 0;
+  std::string currency;  // Added in version 2
+};
+
+struct Order {
+  std::uint64_t id = 0;
+  Side side = Side::kBuy;
+  Price price;
+  std::vector<std::uint32_t> lots;
+  std::string note = "none";  // Added in version 1
+  std::array<double, 2> limits = {};
+};
+
+struct Batch {
+  std::vector<std::uint32_t> lots;
+};
+
+struct Unsupported {
+  std::vector<bool> flags;
+};
+
+}  // namespace
+
+template <>
+struct ctti::meta<Price> {
+  using type = Price;
+
+  static constexpr auto reflection =
+      ctti::make_reflection(ctti::member<"units", &Price::units>(), ctti::member<"nanos", &Price::nanos>(),
+                            ctti::member<"currency", &Price::currency>(ctti::since<2>{}));
+};
+
+template <>
+struct ctti::meta<Order> {
+  using type = Order;
+
+  static constexpr auto reflection = ctti::make_reflection(
+      ctti::member<"id", &Order::id>(), ctti::member<"side", &Order::side>(), ctti::member<"price", &Order::price>(),
+      ctti::member<"lots", &Order::lots>(), ctti::member<"note", &Order::note>(ctti::since<1>{}),
+      ctti::member<"limits", &Order::limits>());
+};
+
+template <>
+struct ctti::meta<Batch> {
+  using type = Batch;
+
+  static constexpr auto reflection = ctti::make_reflection(ctti::member<"lots", &Batch::lots>());
+};
+
+template <>
+struct ctti::meta<Unsupported> {
+  using type = Unsupported;
+
+  static constexpr auto reflection = ctti::make_reflection(ctti::member<"flags", &Unsupported::flags>());
+};
+
+namespace {
+
+Order MakeOrder() {
+  Order order;
+  order.id = 42;
+  order.side = Side::kSell;
+  order.price = {.units = 12, .nanos = 500, .currency = "EUR"};
+  order.lots = {1, 2, 3};
+  order.note = "rush";
+  order.limits = {1.5, 2.5};
+  return order;
+}
+
+}  // namespace
+
+TEST_SUITE("serialize") {
+  TEST_CASE("schema_version") {
+    static_assert(ctti::serializable<Order>);
+    static_assert(!ctti::serializable<Unsupported>);
+    static_assert(ctti::schema_version<Price> == 2);
+    static_assert(ctti::schema_version<Order> == 2);
+  }
+
+  TEST_CASE("round_trip_latest") {
+    const Order order = MakeOrder();
+    ctti::byte_writer writer;
+    ctti::serialize(order, writer);
+
+    ctti::byte_reader reader(writer.bytes());
+    Order result;
+    REQUIRE(ctti::deserialize(reader, result));
+    CHECK_EQ(reader.remaining(), 0);
+    CHECK_EQ(result.id, 42);
+    CHECK_EQ(result.side, Side::kSell);
+    CHECK_EQ(result.price.units, 12);
+    CHECK_EQ(result.price.currency, "EUR");
+    CHECK_EQ(result.lots, std::vector<std::uint32_t>{1, 2, 3});
+    CHECK_EQ(result.note, "rush");
+    CHECK_EQ(result.limits[1], 2.5);
+  }
+
+  TEST_CASE("older_versions_omit_newer_fields") {
+    const Order order = MakeOrder();
+    ctti::byte_writer v0;
+    ctti::byte_writer v1;
+    ctti::byte_writer v2;
+    ctti::serialize<0>(order, v0);
+    ctti::serialize<1>(order, v1);
+    ctti::serialize<2>(order, v2);
+
+    const std::size_t note_size = sizeof(std::uint64_t) + order.note.size();
+    const std::size_t currency_size = sizeof(std::uint64_t) + order.price.currency.size();
+    CHECK_EQ(v1.size(), v0.size() + note_size);
+    CHECK_EQ(v2.size(), v1.size() + currency_size);
+  }
+
+  TEST_CASE("read_older_payload") {
+    const Order order = MakeOrder();
+    ctti::byte_writer writer;
+    ctti::serialize<0>(order, writer);
+
+    ctti::byte_reader reader(writer.bytes());
+    Order result;
+    REQUIRE(ctti::deserialize(reader, result, 0));
+    CHECK_EQ(reader.remaining(), 0);
+    CHECK_EQ(result.id, 42);
+    CHECK_EQ(result.lots.size(), 3);
+    CHECK_EQ(result.limits[0], 1.5);
+    CHECK_EQ(result.note, "none");
+    CHECK(result.price.currency.empty());
+  }
+
+  TEST_CASE("rejects_unknown_version_and_truncation") {
+    ctti::byte_writer writer;
+    ctti::serialize(MakeOrder(), writer);
+    Order result;
+
+    ctti::byte_reader future(writer.bytes());
+    CHECK_FALSE(ctti::deserialize(future, result, 3));
+
+    const auto bytes = writer.release();
+    CHECK_EQ(writer.size(), 0);
+    ctti::byte_reader truncated(std::span<const std::byte>(bytes).first(bytes.size() - 1));
+    CHECK_FALSE(ctti::deserialize(truncated, result));
+  }
+
+  TEST_CASE("rejects_oversized_count") {
+    ctti::byte_writer writer;
+    const std::uint64_t count = 1ULL << 60;
+    writer.write_bytes(&count, sizeof(count));
+
+    Batch batch;
+    ctti::byte_reader reader(writer.bytes());
+    CHECK_FALSE(ctti::deserialize(reader, batch));
+    CHECK(batch.lots.empty());
+  }
+
+  TEST_CASE("serialize_range_matches_sequential") {
+    std::vector<Order> orders(1000, MakeOrder());
+    for (std::size_t i = 0; i < orders.size(); ++i) {
+      orders[i].id = i;
+      orders[i].lots.resize(i % 7);
+      orders[i].note = std::string(i % 13, 'n');
+    }
+
+    ctti::byte_writer sequential;
+    for (const Order& order : orders) {
+      ctti::serialize<1>(order, sequential);
+    }
+
+    ctti::byte_writer parallel;
+    parallel.write_bytes("x", 1);
+    ctti::serialize_range<1>(std::span<const Order>(orders), parallel, {.thread_count = 4, .chunk_bytes = 512});
+    REQUIRE_EQ(parallel.size(), sequential.size() + 1);
+    CHECK(std::equal(sequential.bytes().begin(), sequential.bytes().end(), parallel.bytes().begin() + 1));
+  }
+
+  TEST_CASE("serialize_range_fixed_size") {
+    std::vector<Price> prices(10000);
+    for (std::size_t i = 0; i < prices.size(); ++i) {
+      prices[i].units = static_cast<std::int64_t>(i);
+      prices[i].nanos = static_cast<std::int32_t>(i * 3);
+    }
+
+    // Version 1 leaves out the currency, so every price takes the same number of bytes
+    ctti::byte_writer writer;
+    ctti::serialize_range<1>(std::span<const Price>(prices), writer, {.thread_count = 3, .chunk_bytes = 4096});
+    REQUIRE_EQ(writer.size(), prices.size() * (sizeof(std::int64_t) + sizeof(std::int32_t)));
+
+    ctti::byte_reader reader(writer.bytes());
+    for (const Price& expected : prices) {
+      Price price;
+      REQUIRE(ctti::deserialize(reader, price, 1));
+      CHECK_EQ(price.units, expected.units);
+      CHECK_EQ(price.nanos, expected.nanos);
+    }
+    CHECK_EQ(reader.remaining(), 0);
+  }
+
+  TEST_CASE("serialize_range_sequential_policy") {
+    const std::vector<Order> orders(3, MakeOrder());
+    ctti::byte_writer writer;
+    ctti::serialize_range(std::span<const Order>(orders), writer, ctti::seq);
+
+    ctti::byte_reader reader(writer.bytes());
+    for (std::size_t i = 0; i < orders.size(); ++i) {
+      Order order;
+      REQUIRE(ctti::deserialize(reader, order));
+      CHECK_EQ(order.price.currency, "EUR");
+    }
+    CHECK_EQ(reader.remaining(), 0);
+
+    ctti::byte_writer empty;
+    ctti::serialize_range(std::span<const Order>(), empty);
+    CHECK_EQ(empty.size(), 0);
+  }
+}
@@ -0,0 +1,185 @@
+#include "doctest.h"
+
+#include <ctti/reflection.hpp>
+#include <ctti/soa_vector.hpp>
+
+#include <cstdint>
+#include <numeric>
+#include <string>
+#include <utility>
+
+namespace {
+
+struct Point {
+  double x = 0.0;
+  double y = 0.0;
+
+  double length_squared() const { return x * x + y * y; }
+};
+
+struct Particle {
+  std::string name;
+  float mass = 0.0F;
+  bool active = false;
+};
+
+}  // namespace
+
+template <>
+struct ctti::meta<Point> {
+  using type = Point;
+
+  static constexpr auto reflection =
+      ctti::make_reflection(ctti::member<"x", &Point::x>(), ctti::member<"y", &Point::y>(),
+                            ctti::member<"length_squared", &Point::length_squared>());
+};
+
+template <>
+struct ctti::meta<Particle> {
+  using type = Particle;
+
+  static constexpr auto reflection =
+      ctti::make_reflection(ctti::member<"name", &Particle::name>(), ctti::member<"mass", &Particle::mass>(),
+                            ctti::member<"active", &Particle::active>());
+};
+
+TEST_SUITE("soa_vector") {
+  TEST_CASE("columns_from_data_members") {
+    static_assert(ctti::soa_vector<Point>::column_count == 2);
+    static_assert(ctti::soa_vector<Point>::has_column<"x">());
+    static_assert(!ctti::soa_vector<Point>::has_column<"length_squared">());
+    static_assert(std::same_as<ctti::soa_vector<Particle>::column_type<"active">, bool>);
+
+    ctti::soa_vector<Point> points;
+    CHECK(points.empty());
+    CHECK_EQ(points.size(), 0);
+  }
+
+  TEST_CASE("push_back_and_columns") {
+    ctti::soa_vector<Point> points;
+    for (int i = 0; i < 100; ++i) {
+      points.push_back(Point{static_cast<double>(i), static_cast<double>(i * 2)});
+    }
+
+    REQUIRE_EQ(points.size(), 100);
+
+    auto xs = points.column<"x">();
+    auto ys = points.column<"y">();
+    CHECK_EQ(xs.size(), 100);
+    CHECK_EQ(std::accumulate(xs.begin(), xs.end(), 0.0), 4950.0);
+    CHECK_EQ(std::accumulate(ys.begin(), ys.end(), 0.0), 9900.0);
+
+    CHECK_EQ(reinterpret_cast<std::uintptr_t>(xs.data()) % ctti::detail::kColumnAlignment, 0);
+    CHECK_EQ(reinterpret_cast<std::uintptr_t>(ys.data()) % ctti::detail::kColumnAlignment, 0);
+
+    for (double& x : points.column<"x">()) {
+      x += 1.0;
+    }
+    CHECK_EQ(points[10].get<"x">(), 11.0);
+  }
+
+  TEST_CASE("row_proxy") {
+    ctti::soa_vector<Particle> particles;
+    particles.push_back(Particle{"electron", 0.5F, true});
+    particles.push_back(Particle{"proton", 938.0F, false});
+
+    auto row = particles[1];
+    CHECK_EQ(row.index(), 1);
+    CHECK_EQ(row.get<"name">(), "proton");
+
+    row.set<"active">(true);
+    row.get<"mass">() = 940.0F;
+
+    const Particle loaded = particles[1].load();
+    CHECK_EQ(loaded.name, "proton");
+    CHECK_EQ(loaded.mass, 940.0F);
+    CHECK(loaded.active);
+
+    particles[0] = Particle{"neutron", 939.5F, false};
+    CHECK_EQ(particles.column<"name">()[0], "neutron");
+    CHECK_FALSE(particles.column<"active">()[0]);
+
+    particles[0] = particles[1];
+    CHECK_EQ(static_cast<Particle>(particles[0]).name, "proton");
+
+    constexpr auto mass = ctti::get_symbol<Particle, "mass">();
+    mass.set_value(particles[0], 1.0F);
+    CHECK_EQ(mass.get_value(particles[0]), 1.0F);
+  }
+
+  TEST_CASE("const_access") {
+    ctti::soa_vector<Point> points;
+    points.push_back(Point{3.0, 4.0});
+
+    const auto& view = points;
+    CHECK_EQ(view[0].get<"y">(), 4.0);
+    CHECK(std::same_as<decltype(view.column<"x">()), std::span<const double>>);
+  }
+
+  TEST_CASE("resize_reserve_and_clear") {
+    ctti::soa_vector<Particle> particles(3);
+    CHECK_EQ(particles.size(), 3);
+    CHECK_EQ(particles[2].get<"mass">(), 0.0F);
+
+    particles.reserve(64);
+    CHECK_GE(particles.capacity(), 64);
+
+    particles.push_back(Particle{"muon", 105.7F, true});
+    CHECK_EQ(particles.size(), 4);
+
+    particles.pop_back();
+    CHECK_EQ(particles.size(), 3);
+
+    auto copy = particles;
+    particles.clear();
+    CHECK(particles.empty());
+    CHECK_EQ(copy.size(), 3);
+  }
+
+  TEST_CASE("rvalue_push_back") {
+    ctti::soa_vector<Particle> particles;
+    Particle particle{std::string(64, 'x'), 1.0F, true};
+    particles.push_back(std::move(particle));
+
+    CHECK_EQ(particles[0].get<"name">().size(), 64);
+  }
+
+  TEST_CASE("copy_keeps_capacity") {
+    ctti::soa_vector<Point> points;
+    points.reserve(32);
+    points.push_back(Point{1.0, 2.0});
+
+    auto copy = points;
+    CHECK_EQ(copy.capacity(), points.capacity());
+
+    // Rows up to the capacity are appended without moving any column
+    const double* x = copy.column<"x">().data();
+    const double* y = copy.column<"y">().data();
+    while (copy.size() < copy.capacity()) {
+      copy.push_back(Point{3.0, 4.0});
+    }
+    CHECK_EQ(copy.column<"x">().data(), x);
+    CHECK_EQ(copy.column<"y">().data(), y);
+  }
+
+  TEST_CASE("move_leaves_empty") {
+    ctti::soa_vector<Point> points;
+    points.push_back(Point{1.0, 2.0});
+    points.push_back(Point{3.0, 4.0});
+
+    ctti::soa_vector<Point> moved(std::move(points));
+    CHECK_EQ(moved.size(), 2);
+    CHECK(points.empty());
+    CHECK_EQ(points.capacity(), 0);
+
+    points.push_back(Point{5.0, 6.0});
+    CHECK_EQ(points.size(), 1);
+    CHECK_EQ(points[0].get<"x">(), 5.0);
+
+    moved = std::move(points);
+    CHECK_EQ(moved.size(), 1);
+    CHECK(points.empty());
+    points.push_back(Point{7.0, 8.0});
+    CHECK_EQ(points.column<"y">()[0], 8.0);
+  }
+}
@@ -0,0 +1,140 @@
+#include "doctest.h"
+
+#include <ctti/attributes.hpp>
+#include <ctti/reflection.hpp>
+#include <ctti/split_storage.hpp>
+
+#include <cstdint>
+#include <string>
+#include <utility>
+
+namespace {
+
+struct Order {
+  std::uint64_t id = 0;
+  double price = 0.0;
+  std::int32_t quantity = 0;
+  std::string client;
+  std::string notes;
+  bool active = false;
+
+  int weight() const { return quantity; }
+};
+
+struct Plain {
+  int a = 0;
+  int b = 0;
+};
+
+}  // namespace
+
+template <>
+struct ctti::meta<Order> {
+  using type = Order;
+  static constexpr auto reflection = ctti::make_reflection(
+      ctti::member<"id", &Order::id>(), ctti::member<"price", &Order::price>(ctti::hot{}),
+      ctti::member<"quantity", &Order::quantity>(ctti::hot{}), ctti::member<"client", &Order::client>(ctti::cold{}),
+      ctti::member<"notes", &Order::notes>(), ctti::member<"active", &Order::active>(ctti::hot{}),
+      ctti::member<"weight", &Order::weight>());
+};
+
+template <>
+struct ctti::meta<Plain> {
+  using type = Plain;
+  static constexpr auto reflection =
+      ctti::make_reflection(ctti::member<"a", &Plain::a>(), ctti::member<"b", &Plain::b>());
+};
+
+TEST_SUITE("split_storage") {
+  TEST_CASE("field_placement") {
+    using storage = ctti::split_storage<Order>;
+    static_assert(storage::hot_field_count == 3);
+    static_assert(storage::cold_field_count == 3);
+    static_assert(storage::is_hot<"price">());
+    static_assert(storage::is_hot<"active">());
+    static_assert(!storage::is_hot<"id">());
+    static_assert(!storage::is_hot<"client">());
+    static_assert(storage::has_field<"notes">());
+    static_assert(!storage::has_field<"weight">());
+    static_assert(std::same_as<storage::field_type<"quantity">, std::int32_t>);
+
+    static_assert(ctti::split_storage<Plain>::hot_field_count == 0);
+    static_assert(ctti::split_storage<Plain>::cold_field_count == 2);
+  }
+
+  TEST_CASE("push_back_and_access") {
+    ctti::split_storage<Order> orders;
+    CHECK(orders.empty());
+    for (int i = 0; i < 20; ++i) {
+      orders.push_back(Order{.id = static_cast<std::uint64_t>(i),
+                             .price = 10.0 + i,
+                             .quantity = i,
+                             .client = "client" + std::to_string(i),
+                             .notes = {},
+                             .active = i % 2 == 0});
+    }
+    REQUIRE_EQ(orders.size(), 20);
+    CHECK_GE(orders.capacity(), 20);
+
+    double exposure = 0.0;
+    for (std::size_t i = 0; i < orders.size(); ++i) {
+      if (orders[i].get<"active">()) {
+        exposure += orders[i].get<"price">() * orders[i].get<"quantity">();
+      }
+    }
+    CHECK_EQ(exposure, doctest::Approx(2040.0));
+
+    orders[5].set<"price">(99.5);
+    orders[5].set<"client">("vip");
+    const Order loaded = orders[5].load();
+    CHECK_EQ(loaded.id, 5);
+    CHECK_EQ(loaded.price, 99.5);
+    CHECK_EQ(loaded.quantity, 5);
+    CHECK_EQ(loaded.client, "vip");
+    CHECK_FALSE(loaded.active);
+
+    const auto& view = orders;
+    CHECK_EQ(view[3].get<"client">(), "client3");
+    CHECK_EQ(static_cast<Order>(view[3]).id, 3);
+  }
+
+  TEST_CASE("assign_move_and_resize") {
+    ctti::split_storage<Order> orders(2);
+    CHECK_EQ(orders.size(), 2);
+    CHECK_EQ(orders[1].get<"price">(), 0.0);
+
+    Order order{.id = 7, .price = 1.5, .quantity = 3, .client = "moved", .notes = "long note", .active = true};
+    orders[0] = std::move(order);
+    CHECK_EQ(orders[0].get<"notes">(), "long note");
+    orders[1] = orders[0];
+    CHECK_EQ(orders[1].get<"id">(), 7);
+    CHECK_EQ(orders[1].get<"client">(), "moved");
+
+    orders.pop_back();
+    CHECK_EQ(orders.size(), 1);
+    orders.resize(4);
+    CHECK_EQ(orders.size(), 4);
+    CHECK_EQ(orders[3].get<"quantity">(), 0);
+
+    ctti::split_storage<Order> copy = orders;
+    orders.clear();
+    CHECK(orders.empty());
+    CHECK_EQ(copy.size(), 4);
+    CHECK_EQ(copy[0].get<"client">(), "moved");
+  }
+
+  TEST_CASE("symbol_access") {
+    ctti::split_storage<Order> orders;
+    orders.push_back(Order{.id = 1, .price = 2.5, .quantity = 4, .client = "a", .notes = {}, .active = true});
+
+    constexpr auto price = ctti::get_symbol<Order, "price">();
+    constexpr auto client = ctti::get_symbol<Order, "client">();
+    CHECK_EQ(price.get_value(orders[0]), 2.5);
+    price.set_value(orders[0], 3.0);
+    client.set_value(orders[0], "b");
+    CHECK_EQ(orders[0].get<"price">(), 3.0);
+
+    const auto& view = orders;
+    CHECK_EQ(client.get_value(view[0]), "b");
+  }
+}
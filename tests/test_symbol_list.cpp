@@ -0,0 +1,91 @@
+#include "doctest.h"
+
+#include <ctti/attributes.hpp>
+#include <ctti/reflection.hpp>
+#include <ctti/symbol_list.hpp>
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace {
+
+struct Account {
+  int id = 1;
+  std::string owner = "alice";
+  double balance = 10.0;
+  int legacy_code = 7;
+  int cache = 3;
+
+  int total() const { return id + legacy_code; }
+};
+
+struct Plain {
+  int a = 0;
+  int b = 0;
+};
+
+// Only compiles for int members, so iterating over a list that holds other symbols would be a hard error
+template <typename Symbol>
+int IntValue(Symbol symbol, const Account& account) {
+  const int& value = symbol.get_value(account);
+  return value;
+}
+
+}  // namespace
+
+template <>
+struct ctti::meta<Account> {
+  using type = Account;
+  static constexpr auto reflection = ctti::make_reflection(
+      ctti::member<"id", &Account::id>(ctti::validated{}), ctti::member<"owner", &Account::owner>(),
+      ctti::member<"balance", &Account::balance>(ctti::validated{}, ctti::since<2>{}),
+      ctti::member<"legacy_code", &Account::legacy_code>(ctti::deprecated{}),
+      ctti::member<"cache", &Account::cache>(ctti::internal{}), ctti::member<"total", &Account::total>());
+};
+
+template <>
+struct ctti::meta<Plain> {
+  using type = Plain;
+  static constexpr auto reflection =
+      ctti::make_reflection(ctti::member<"a", &Plain::a>(), ctti::member<"b", &Plain::b>());
+};
+
+TEST_SUITE("symbol_list") {
+  TEST_CASE("symbols_with") {
+    constexpr auto validated = ctti::symbols_with<Account, ctti::validated>();
+    static_assert(validated.size == 2);
+    static_assert(validated.names()[0] == "id");
+    static_assert(validated.names()[1] == "balance");
+
+    constexpr auto versioned = ctti::symbols_with<Account, ctti::validated, ctti::since<2>>();
+    static_assert(versioned.size == 1);
+    static_assert(decltype(versioned)::at<0>::name == "balance");
+
+    static_assert(ctti::symbols_with<Plain, ctti::validated>().size == 0);
+    static_assert(ctti::symbols_with<Plain>().size == 2);
+  }
+
+  TEST_CASE("symbols_without") {
+    constexpr auto visible = ctti::symbols_without<Account, ctti::internal, ctti::deprecated>();
+    static_assert(visible.size == 4);
+    CHECK_EQ(visible.names()[0], "id");
+    CHECK_EQ(visible.names()[1], "owner");
+    CHECK_EQ(visible.names()[2], "balance");
+    CHECK_EQ(visible.names()[3], "total");
+
+    static_assert(ctti::symbols_without<Plain, ctti::internal>().size == 2);
+  }
+
+  TEST_CASE("for_each_instantiates_matching_symbols_only") {
+    const Account account;
+    int sum = 0;
+    ctti::symbols_with<Account, ctti::deprecated>().for_each([&](auto symbol) { sum += IntValue(symbol, account); });
+    ctti::symbols_with<Account, ctti::internal>().for_each([&](auto symbol) { sum += IntValue(symbol, account); });
+    CHECK_EQ(sum, 10);
+
+    std::vector<std::string_view> names;
+    ctti::symbols_without<Account, ctti::validated>().for_each([&](auto symbol) { names.push_back(symbol.name); });
+    CHECK_EQ(names, std::vector<std::string_view>{"owner", "legacy_code", "cache", "total"});
+  }
+}
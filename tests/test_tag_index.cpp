@@ -0,0 +1,88 @@
+#include "doctest.h"
+
+#include <ctti/attributes.hpp>
+#include <ctti/reflection.hpp>
+#include <ctti/tag_index.hpp>
+
+#include <optional>
+#include <string>
+
+namespace {
+
+struct AuditedTag {};
+
+using Audited = ctti::tag_attribute<AuditedTag>;
+
+struct User {
+  int id = 0;
+  std::string name;
+  std::string password_hash;
+  int legacy_flags = 0;
+
+  void reset() {}
+};
+
+using AuditTags = ctti::tag_universe<ctti::internal_tag, AuditedTag>;
+
+}  // namespace
+
+template <>
+struct ctti::meta<User> {
+  using type = User;
+  static constexpr auto reflection = ctti::make_reflection(
+      ctti::member<"id", &User::id>(ctti::read_only{}, Audited{}),
+      ctti::member<"name", &User::name>(ctti::validated{}),
+      ctti::member<"password_hash", &User::password_hash>(ctti::write_only{}, ctti::internal{}, Audited{}),
+      ctti::member<"legacy_flags", &User::legacy_flags>(ctti::deprecated{}, ctti::since<2>{}),
+      ctti::member<"reset", &User::reset>(ctti::internal{}));
+};
+
+TEST_SUITE("tag_index") {
+  TEST_CASE("universe_mask") {
+    static_assert(ctti::builtin_tags::size == 5);
+    static_assert(ctti::builtin_tags::mask<ctti::read_only_tag>() == 1);
+    static_assert(ctti::builtin_tags::mask<ctti::validated_tag, ctti::write_only_tag>() == 0b10010);
+    static_assert(ctti::builtin_tags::mask<>() == 0);
+    static_assert(AuditTags::contains<AuditedTag>());
+    static_assert(!AuditTags::contains<ctti::read_only_tag>());
+  }
+
+  TEST_CASE("builtin_masks") {
+    using index = ctti::tag_index<User>;
+    static_assert(index::size == 5);
+    static_assert(index::masks[0] == ctti::builtin_tags::mask<ctti::read_only_tag>());
+    static_assert(index::masks[1] == ctti::builtin_tags::mask<ctti::validated_tag>());
+    static_assert(index::masks[2] == ctti::builtin_tags::mask<ctti::write_only_tag, ctti::internal_tag>());
+    static_assert(index::masks[3] == ctti::builtin_tags::mask<ctti::deprecated_tag>());
+    static_assert(index::masks[4] == ctti::builtin_tags::mask<ctti::internal_tag>());
+  }
+
+  TEST_CASE("runtime_queries") {
+    using index = ctti::tag_index<User>;
+    constexpr auto kHidden = ctti::builtin_tags::mask<ctti::internal_tag, ctti::deprecated_tag>();
+
+    const std::string requested = "password_hash";
+    const auto symbol = index::index_of(requested);
+    REQUIRE(symbol.has_value());
+    CHECK_EQ(*symbol, 2);
+    CHECK(index::has_any(*symbol, kHidden));
+    CHECK(index::has_all(*symbol, ctti::builtin_tags::mask<ctti::write_only_tag, ctti::internal_tag>()));
+    CHECK_FALSE(index::has_all(*symbol, ctti::builtin_tags::mask<ctti::write_only_tag, ctti::read_only_tag>()));
+
+    const auto name = index::index_of("name");
+    REQUIRE(name.has_value());
+    CHECK_FALSE(index::has_any(*name, kHidden));
+    CHECK_EQ(index::mask_of(*name), ctti::builtin_tags::mask<ctti::validated_tag>());
+
+    CHECK_FALSE(index::index_of("missing").has_value());
+  }
+
+  TEST_CASE("custom_universe") {
+    using index = ctti::tag_index<User, AuditTags>;
+    static_assert(index::masks[0] == AuditTags::mask<AuditedTag>());
+    static_assert(index::masks[1] == 0);
+    static_assert(index::masks[2] == AuditTags::mask<ctti::internal_tag, AuditedTag>());
+    static_assert(index::masks[4] == AuditTags::mask<ctti::internal_tag>());
+    CHECK(index::has_all(*index::index_of("id"), AuditTags::mask<AuditedTag>()));
+  }
+}
@@ -0,0 +1,144 @@
+#include "doctest.h"
+
+#include <ctti/attributes.hpp>
+#include <ctti/reflection.hpp>
+#include <ctti/soa_vector.hpp>
+#include <ctti/validate.hpp>
+
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace {
+
+struct Address {
+  std::string city = "Paris";
+  std::string zip = "75001";
+};
+
+struct Customer {
+  std::string name = "alice";
+  std::uint32_t age = 30;
+  double score = 0.5;
+  Address address;
+  int unchecked = -1000;
+};
+
+struct Sample {
+  std::int32_t level = 0;
+  float ratio = 0.0F;
+  std::uint8_t channel = 0;
+};
+
+}  // namespace
+
+template <>
+struct ctti::meta<Address> {
+  using type = Address;
+  static constexpr auto reflection = ctti::make_reflection(ctti::member<"city", &Address::city>(ctti::non_empty{}),
+                                                           ctti::member<"zip", &Address::zip>(ctti::max_length<5>{}));
+};
+
+template <>
+struct ctti::meta<Customer> {
+  using type = Customer;
+  static constexpr auto reflection = ctti::make_reflection(
+      ctti::member<"name", &Customer::name>(ctti::non_empty{}, ctti::max_length<8>{}, ctti::validated{}),
+      ctti::member<"age", &Customer::age>(ctti::range<-1, 150>{}),
+      ctti::member<"score", &Customer::score>(ctti::range<0.0, 1.0>{}), ctti::member<"address", &Customer::address>(),
+      ctti::member<"unchecked", &Customer::unchecked>());
+};
+
+template <>
+struct ctti::meta<Sample> {
+  using type = Sample;
+  static constexpr auto reflection = ctti::make_reflection(
+      ctti::member<"level", &Sample::level>(ctti::range<-100, 100>{}),
+      ctti::member<"ratio", &Sample::ratio>(ctti::range<0.0F, 1.0F>{}),
+      ctti::member<"channel", &Sample::channel>(ctti::range<1, 8>{}));
+};
+
+TEST_SUITE("validate") {
+  TEST_CASE("valid_object") {
+    CHECK_FALSE(ctti::validate(Customer{}).has_value());
+  }
+
+  TEST_CASE("reports_first_broken_constraint") {
+    Customer customer;
+    customer.name.clear();
+    auto error = ctti::validate(customer);
+    REQUIRE(error.has_value());
+    CHECK_EQ(error->field, "name");
+    CHECK_EQ(error->constraint, "non_empty");
+
+    customer.name = "bartholomew";
+    error = ctti::validate(customer);
+    REQUIRE(error.has_value());
+    CHECK_EQ(error->constraint, "max_length");
+
+    customer.name = "bob";
+    customer.age = 151;
+    error = ctti::validate(customer);
+    REQUIRE(error.has_value());
+    CHECK_EQ(error->field, "age");
+    CHECK_EQ(error->constraint, "range");
+
+    customer.age = 0;
+    customer.score = std::numeric_limits<double>::quiet_NaN();
+    error = ctti::validate(customer);
+    REQUIRE(error.has_value());
+    CHECK_EQ(error->field, "score");
+
+    customer.score = 1.0;
+    customer.address.zip = "750010";
+    error = ctti::validate(customer);
+    REQUIRE(error.has_value());
+    CHECK_EQ(error->field, "zip");
+    CHECK_EQ(error->constraint, "max_length");
+  }
+
+  TEST_CASE("constexpr") {
+    constexpr Sample kValid{.level = 100, .ratio = 0.25F, .channel = 8};
+    constexpr Sample kInvalid{.level = 100, .ratio = 0.25F, .channel = 0};
+    static_assert(!ctti::validate(kValid).has_value());
+    static_assert(ctti::validate(kInvalid)->field == "channel");
+  }
+
+  TEST_CASE("validate_columns_soa") {
+    ctti::soa_vector<Sample> samples;
+    for (int i = 0; i < 200; ++i) {
+      samples.push_back(Sample{.level = i - 100, .ratio = 0.5F, .channel = static_cast<std::uint8_t>(i % 8 + 1)});
+    }
+    samples[3] = Sample{.level = 0, .ratio = 1.5F, .channel = 1};
+    samples[64] = Sample{.level = 0, .ratio = 0.5F, .channel = 9};
+    samples[199] = Sample{.level = 101, .ratio = 0.5F, .channel = 1};
+
+    const auto bitmap = ctti::validate_columns(samples);
+    CHECK_EQ(bitmap.size(), 200);
+    CHECK_EQ(bitmap.words().size(), 4);
+    CHECK_EQ(bitmap.failure_count(), 3);
+    CHECK(bitmap.failed(3));
+    CHECK(bitmap.failed(64));
+    CHECK(bitmap.failed(199));
+    CHECK_FALSE(bitmap.failed(0));
+    CHECK_FALSE(bitmap.all_valid());
+  }
+
+  TEST_CASE("validate_columns_span") {
+    std::vector<Customer> customers(70);
+    customers[1].address.city.clear();
+    customers[65].name.clear();
+    customers[69].unchecked = 5;
+
+    const auto bitmap = ctti::validate_columns(std::span<const Customer>(customers));
+    CHECK_EQ(bitmap.failure_count(), 2);
+    CHECK(bitmap.failed(1));
+    CHECK(bitmap.failed(65));
+
+    const auto empty = ctti::validate_columns(std::span<const Customer>());
+    CHECK_EQ(empty.size(), 0);
+    CHECK(empty.all_valid());
+  }
+}
@@ -0,0 +1,178 @@
+#include "doctest.h"
+
+#include <ctti/reflection.hpp>
+#include <ctti/view.hpp>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace {
+
+enum class Venue : std::uint16_t { kPrimary = 1, kDark = 0x0102 };
+
+struct Price {
+  std::int64_t units;
+  float scale;
+};
+
+struct Trade {
+  std::uint32_t symbol_id;
+  Venue venue;
+  Price price;
+  std::array<std::uint16_t, 2> flags;
+  double quantity;
+};
+
+struct Named {
+  std::string name;
+};
+
+struct Grid {
+  std::array<std::array<std::uint16_t, 3>, 2> cells;
+};
+
+struct Samples {
+  std::int32_t values[4];
+};
+
+}  // namespace
+
+template <>
+struct ctti::meta<Price> {
+  using type = Price;
+  static constexpr auto reflection =
+      ctti::make_reflection(ctti::member<"units", &Price::units>(), ctti::member<"scale", &Price::scale>());
+};
+
+template <>
+struct ctti::meta<Trade> {
+  using type = Trade;
+  static constexpr auto reflection = ctti::make_reflection(
+      ctti::member<"symbol_id", &Trade::symbol_id>(), ctti::member<"venue", &Trade::venue>(),
+      ctti::member<"price", &Trade::price>(), ctti::member<"flags", &Trade::flags>(),
+      ctti::member<"quantity", &Trade::quantity>());
+};
+
+template <>
+struct ctti::meta<Named> {
+  using type = Named;
+  static constexpr auto reflection = ctti::make_reflection(ctti::member<"name", &Named::name>());
+};
+
+template <>
+struct ctti::meta<Grid> {
+  using type = Grid;
+  static constexpr auto reflection = ctti::make_reflection(ctti::member<"cells", &Grid::cells>());
+};
+
+template <>
+struct ctti::meta<Samples> {
+  using type = Samples;
+  static constexpr auto reflection = ctti::make_reflection(ctti::member<"values", &Samples::values>());
+};
+
+namespace {
+
+constexpr std::endian kForeignOrder =
+    std::endian::native == std::endian::little ? std::endian::big : std::endian::little;
+
+Trade MakeTrade() {
+  return Trade{.symbol_id = 7,
+               .venue = Venue::kDark,
+               .price = {.units = -1234, .scale = 0.25F},
+               .flags = {0x0A0B, 3},
+               .quantity = 12.5};
+}
+
+template <typename T>
+void ReverseInPlace(std::byte* data) {
+  std::reverse(data, data + sizeof(T));
+}
+
+}  // namespace
+
+TEST_SUITE("view") {
+  TEST_CASE("viewable") {
+    static_assert(ctti::viewable<Trade>);
+    static_assert(ctti::viewable<Trade, kForeignOrder>);
+    static_assert(!ctti::viewable<Named>);
+    static_assert(!ctti::viewable<Samples>);
+  }
+
+  TEST_CASE("reads_fields_in_place") {
+    const Trade trade = MakeTrade();
+    std::array<std::byte, sizeof(Trade) + 1> storage = {};
+    // Misaligned on purpose
+    std::memcpy(storage.data() + 1, &trade, sizeof(Trade));
+
+    ctti::view<Trade> trade_view(std::span<const std::byte>(storage).subspan(1));
+    CHECK_EQ(trade_view.get<"symbol_id">(), 7);
+    CHECK_EQ(trade_view.get<"venue">(), Venue::kDark);
+    CHECK_EQ(trade_view.get<"quantity">(), 12.5);
+    CHECK_EQ(trade_view.get<"flags">()[0], 0x0A0B);
+    CHECK_EQ(trade_view.bytes().data(), storage.data() + 1);
+  }
+
+  TEST_CASE("nested_views") {
+    const Trade trade = MakeTrade();
+    const auto bytes = std::as_bytes(std::span(&trade, 1));
+
+    ctti::view<Trade> trade_view(bytes);
+    auto price = trade_view.get<"price">();
+    static_assert(std::is_same_v<decltype(price), ctti::view<Price>>);
+    CHECK_EQ(price.get<"units">(), -1234);
+    CHECK_EQ(price.get<"scale">(), 0.25F);
+  }
+
+  TEST_CASE("foreign_byte_order") {
+    Trade trade = MakeTrade();
+    auto* data = reinterpret_cast<std::byte*>(&trade);
+    ReverseInPlace<std::uint32_t>(data + offsetof(Trade, symbol_id));
+    ReverseInPlace<Venue>(data + offsetof(Trade, venue));
+    ReverseInPlace<std::int64_t>(data + offsetof(Trade, price) + offsetof(Price, units));
+    ReverseInPlace<float>(data + offsetof(Trade, price) + offsetof(Price, scale));
+    ReverseInPlace<std::uint16_t>(data + offsetof(Trade, flags));
+    ReverseInPlace<std::uint16_t>(data + offsetof(Trade, flags) + sizeof(std::uint16_t));
+    ReverseInPlace<double>(data + offsetof(Trade, quantity));
+
+    ctti::view<Trade, kForeignOrder> trade_view(std::as_bytes(std::span(&trade, 1)));
+    CHECK_EQ(trade_view.get<"symbol_id">(), 7);
+    CHECK_EQ(trade_view.get<"venue">(), Venue::kDark);
+    CHECK_EQ(trade_view.get<"price">().get<"units">(), -1234);
+    CHECK_EQ(trade_view.get<"price">().get<"scale">(), 0.25F);
+    CHECK_EQ(trade_view.get<"flags">(), std::array<std::uint16_t, 2>{0x0A0B, 3});
+    CHECK_EQ(trade_view.get<"quantity">(), 12.5);
+  }
+
+  TEST_CASE("foreign_byte_order_nested_arrays") {
+    Grid grid{.cells = {{{1, 2, 0x0304}, {5, 0x0607, 8}}}};
+    auto* data = reinterpret_cast<std::byte*>(&grid);
+    for (std::size_t i = 0; i < 6; ++i) {
+      ReverseInPlace<std::uint16_t>(data + i * sizeof(std::uint16_t));
+    }
+
+    ctti::view<Grid, kForeignOrder> grid_view(std::as_bytes(std::span(&grid, 1)));
+    const auto cells = grid_view.get<"cells">();
+    CHECK_EQ(cells[0], std::array<std::uint16_t, 3>{1, 2, 0x0304});
+    CHECK_EQ(cells[1], std::array<std::uint16_t, 3>{5, 0x0607, 8});
+  }
+
+  TEST_CASE("scan_records") {
+    std::vector<Trade> trades(4, MakeTrade());
+    trades[2].quantity = 1.0;
+    const auto log = std::as_bytes(std::span(trades));
+
+    double total = 0.0;
+    for (std::size_t offset = 0; offset + sizeof(Trade) <= log.size(); offset += sizeof(Trade)) {
+      total += ctti::view<Trade>(log.subspan(offset, sizeof(Trade))).get<"quantity">();
+    }
+    CHECK_EQ(total, 38.5);
+  }
+}